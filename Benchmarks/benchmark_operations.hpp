@@ -0,0 +1,48 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef BENCHMARKS_BENCHMARK_OPERATIONS_HPP_
+#define BENCHMARKS_BENCHMARK_OPERATIONS_HPP_
+
+#include <random>
+
+#include "Sources/Models/rectangular.hpp"
+#include "Sources/ParameterSpaces/parameter_space.hpp"
+#include "Sources/Utilities/named_type.hpp"
+#include "Sources/Utilities/std_container_operations.hpp"
+
+// Operations shared by all benchmarks such as 1.) generating three-dimensional splines of rectangular unit domains
+// (see models::rectangular::Generate) with the same number of non-zero knot spans and degree along each parametric
+// dimension and 2.) drawing reproducible pseudo-random parametric coordinates.
+//
+// Example:
+//   Nurbs<2, 3> const &nurbs = GenerateSpline<2, true>(16, 3);  // 16x16 non-zero knot spans of degrees p = 3.
+//   ParametricCoordinates<2> const &parametric_coordinates = DrawParametricCoordinates<2>(1024);
+namespace splinelib::benchmarks::benchmark_operations {
+
+template<int parametric_dimensionality>
+using ParametricCoordinates =
+    Vector<typename sources::parameter_spaces::ParameterSpace<parametric_dimensionality>::ParametricCoordinate_>;
+
+template<int parametric_dimensionality, bool is_rational>
+auto GenerateSpline(int const &number_of_non_zero_knot_spans, int const &degree);
+template<int parametric_dimensionality>
+ParametricCoordinates<parametric_dimensionality> DrawParametricCoordinates(int const &number_of_parametric_coordinates);
+
+#include "Benchmarks/benchmark_operations.inc"
+
+}  // namespace splinelib::benchmarks::benchmark_operations
+
+#endif  // BENCHMARKS_BENCHMARK_OPERATIONS_HPP_
@@ -0,0 +1,70 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <benchmark/benchmark.h>
+#include "Benchmarks/benchmark_operations.hpp"
+#include "Sources/Utilities/named_type.hpp"
+
+namespace splinelib::benchmarks::splines {
+
+using benchmark_operations::DrawParametricCoordinates, benchmark_operations::GenerateSpline;
+
+constexpr int const kNumberOfNonZeroKnotSpans{8}, kNumberOfParametricCoordinates{1024};
+
+// Evaluates B-splines and NURBS at pseudo-random parametric coordinates (the argument being the degree).
+template<int parametric_dimensionality, bool is_rational>
+void Evaluate(benchmark::State &state) {
+  auto const spline{GenerateSpline<parametric_dimensionality, is_rational>(kNumberOfNonZeroKnotSpans, state.range(0))};
+  auto const parametric_coordinates{DrawParametricCoordinates<parametric_dimensionality>(
+                                        kNumberOfParametricCoordinates)};
+  int parametric_coordinate{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline(parametric_coordinates[parametric_coordinate]));
+    parametric_coordinate = ((parametric_coordinate + 1) % kNumberOfParametricCoordinates);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Evaluates the derivatives of B-splines and NURBS at pseudo-random parametric coordinates (the arguments being the
+// degree and the order of the derivative along each parametric dimension).
+template<int parametric_dimensionality, bool is_rational>
+void EvaluateDerivative(benchmark::State &state) {
+  auto const spline{GenerateSpline<parametric_dimensionality, is_rational>(kNumberOfNonZeroKnotSpans, state.range(0))};
+  auto const parametric_coordinates{DrawParametricCoordinates<parametric_dimensionality>(
+                                        kNumberOfParametricCoordinates)};
+  typename decltype(spline)::Derivative_ derivative;
+  derivative.fill(Derivative{static_cast<int>(state.range(1))});
+  int parametric_coordinate{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline(parametric_coordinates[parametric_coordinate], derivative));
+    parametric_coordinate = ((parametric_coordinate + 1) % kNumberOfParametricCoordinates);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(Evaluate, 1, false)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(Evaluate, 2, false)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(Evaluate, 3, false)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(Evaluate, 1, true)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(Evaluate, 2, true)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(Evaluate, 3, true)->DenseRange(1, 5)->ArgName("degree");
+BENCHMARK_TEMPLATE(EvaluateDerivative, 1, false)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+BENCHMARK_TEMPLATE(EvaluateDerivative, 2, false)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+BENCHMARK_TEMPLATE(EvaluateDerivative, 3, false)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+BENCHMARK_TEMPLATE(EvaluateDerivative, 1, true)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+BENCHMARK_TEMPLATE(EvaluateDerivative, 2, true)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+BENCHMARK_TEMPLATE(EvaluateDerivative, 3, true)->ArgsProduct({{1, 3, 5}, {1, 2, 3}})->ArgNames({"degree", "order"});
+
+}  // namespace splinelib::benchmarks::splines
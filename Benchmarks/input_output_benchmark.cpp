@@ -0,0 +1,101 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <filesystem>
+#include <memory>
+#include <tuple>
+
+#include <benchmark/benchmark.h>
+#include "Benchmarks/benchmark_operations.hpp"
+#include "Sources/InputOutput/iges.hpp"
+#include "Sources/InputOutput/irit.hpp"
+#include "Sources/InputOutput/operations.hpp"
+#include "Sources/InputOutput/vtk.hpp"
+#include "Sources/InputOutput/xml.hpp"
+#include "Sources/Utilities/named_type.hpp"
+#include "Sources/Utilities/std_container_operations.hpp"
+
+namespace splinelib::benchmarks::input_output {
+
+using FileFormat = sources::input_output::operations::FileFormat;
+using Splines = sources::input_output::Splines;
+
+constexpr int const kDegree{3};
+constexpr Length const kNumberOfParametricCoordinates{10};
+
+// Returns a single NURBS surface (the argument being the number of non-zero knot spans along each parametric dimension)
+// and the name of a temporary file of the file format.
+template<FileFormat file_format>
+auto Prepare(benchmark::State const &state) {
+  using Nurbs = sources::splines::Nurbs<2, 3>;
+
+  String file_extension;
+  switch (file_format) {
+    case FileFormat::kIges:
+      file_extension = ".iges";
+      break;
+    case FileFormat::kIrit:
+      file_extension = ".itd";
+      break;
+    case FileFormat::kVtk:
+      file_extension = ".vtk";
+      break;
+    default:
+      file_extension = ".xml";
+  }
+  return std::make_tuple(Splines{std::make_shared<Nurbs>(benchmark_operations::GenerateSpline<2, true>(
+                                     state.range(0), kDegree))},
+                         (std::filesystem::temp_directory_path() / ("splinelib_benchmark" + file_extension)).string());
+}
+
+template<FileFormat file_format>
+void WriteFile(Splines const &splines, String const &file_name) {
+  if constexpr (file_format == FileFormat::kIges) {
+    sources::input_output::iges::Write(splines, file_name);
+  } else if constexpr (file_format == FileFormat::kIrit) {
+    sources::input_output::irit::Write(splines, file_name);
+  } else if constexpr (file_format == FileFormat::kVtk) {
+    sources::input_output::vtk::Sample(splines, file_name, {{kNumberOfParametricCoordinates,
+                                                             kNumberOfParametricCoordinates}});
+  } else {
+    sources::input_output::xml::Write(splines, file_name);
+  }
+}
+
+// VTK files can be written (i.e., splines can be sampled) but not read.
+template<FileFormat file_format>
+void Write(benchmark::State &state) {
+  auto const &[splines, file_name] = Prepare<file_format>(state);
+  for (auto _ : state) WriteFile<file_format>(splines, file_name);
+  std::filesystem::remove(file_name);
+}
+
+template<FileFormat file_format>
+void Read(benchmark::State &state) {
+  auto const &[splines, file_name] = Prepare<file_format>(state);
+  WriteFile<file_format>(splines, file_name);
+  for (auto _ : state) benchmark::DoNotOptimize(sources::input_output::operations::Read(file_name));
+  std::filesystem::remove(file_name);
+}
+
+BENCHMARK_TEMPLATE(Write, FileFormat::kIges)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Write, FileFormat::kIrit)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Write, FileFormat::kVtk)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Write, FileFormat::kXml)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Read, FileFormat::kIges)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Read, FileFormat::kIrit)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(Read, FileFormat::kXml)->RangeMultiplier(4)->Range(4, 64)->ArgName("knot_spans");
+
+}  // namespace splinelib::benchmarks::input_output
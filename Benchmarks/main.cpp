@@ -13,24 +13,6 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-#ifndef TESTS_PARAMETERSPACES_PARAMETER_SPACE_2D_HPP_
-#define TESTS_PARAMETERSPACES_PARAMETER_SPACE_2D_HPP_
+#include <benchmark/benchmark.h>
 
-#include "Sources/ParameterSpaces/parameter_space.hpp"
-
-namespace splinelib::tests::parameter_spaces {
-
-class ParameterSpace2d final : public sources::parameter_spaces::ParameterSpace<2> {
- public:
-  ParameterSpace2d() = default;
-  ParameterSpace2d(KnotVectors_ knot_vectors, Degrees_ degrees, BSplineBasisFunctions_ basis_functions);
-  ParameterSpace2d(ParameterSpace2d const &other) = default;
-  ParameterSpace2d(ParameterSpace2d &&other) noexcept = default;
-  ParameterSpace2d & operator=(ParameterSpace2d const &rhs) = default;
-  ParameterSpace2d & operator=(ParameterSpace2d &&rhs) noexcept = default;
-  ~ParameterSpace2d() = default;
-};
-
-}  // namespace splinelib::tests::parameter_spaces
-
-#endif  // TESTS_PARAMETERSPACES_PARAMETER_SPACE_2D_HPP_
+BENCHMARK_MAIN();
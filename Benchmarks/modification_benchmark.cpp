@@ -0,0 +1,110 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <memory>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+#include "Benchmarks/benchmark_operations.hpp"
+#include "Sources/ParameterSpaces/knot_vector.hpp"
+#include "Sources/ParameterSpaces/parameter_space.hpp"
+#include "Sources/Utilities/named_type.hpp"
+
+namespace splinelib::benchmarks::splines {
+
+using benchmark_operations::GenerateSpline;
+
+constexpr int const kDegree{2};
+constexpr Dimension const kDimension{};
+constexpr sources::splines::Tolerance const kToleranceRemoval{1.0e-8};
+
+// Constructs the parameter spaces of volumes (the argument being the number of non-zero knot spans along each
+// parametric dimension).
+void ConstructParameterSpace(benchmark::State &state) {
+  using ParameterSpace = sources::parameter_spaces::ParameterSpace<3>;
+  using KnotVector = sources::parameter_spaces::KnotVector;
+
+  int const number_of_non_zero_knot_spans{static_cast<int>(state.range(0))};
+  KnotVector::Knots_ knots(kDegree + 1, ParametricCoordinate{});
+  for (int knot{1}; knot < number_of_non_zero_knot_spans; ++knot)
+      knots.emplace_back(static_cast<double>(knot) / number_of_non_zero_knot_spans);
+  knots.insert(knots.end(), kDegree + 1, ParametricCoordinate{1.0});
+  ParameterSpace::KnotVectors_ knot_vectors;
+  knot_vectors.fill(std::make_shared<KnotVector>(knots));
+  ParameterSpace::Degrees_ degrees;
+  degrees.fill(Degree{kDegree});
+  for (auto _ : state) benchmark::DoNotOptimize(ParameterSpace{knot_vectors, degrees});
+}
+
+// Modifies volumes of growing control nets (the argument being the number of non-zero knot spans along each
+// parametric dimension) by modification(spline, number of non-zero knot spans).  As all modifications change the
+// splines, a new spline is generated (untimed) before each modification.
+template<bool is_rational, typename Modification>
+void Modify(benchmark::State &state, Modification const &modification) {
+  int const number_of_non_zero_knot_spans{static_cast<int>(state.range(0))};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto spline{GenerateSpline<3, is_rational>(number_of_non_zero_knot_spans, kDegree)};
+    state.ResumeTiming();
+    modification(spline, number_of_non_zero_knot_spans);
+    benchmark::ClobberMemory();
+  }
+}
+
+// Inserts a knot into the middle of the first non-zero knot span.
+template<bool is_rational>
+void InsertKnot(benchmark::State &state) {
+  Modify<is_rational>(state, [] (auto &spline, int const &number_of_non_zero_knot_spans) {
+      spline.InsertKnot(kDimension, ParametricCoordinate{0.5 / number_of_non_zero_knot_spans}); });
+}
+
+// Inserts knots into the middles of all non-zero knot spans.
+template<bool is_rational>
+void RefineKnots(benchmark::State &state) {
+  Modify<is_rational>(state, [] (auto &spline, int const &number_of_non_zero_knot_spans) {
+      typename std::remove_reference_t<decltype(spline)>::Knots_ knots;
+      for (int knot_span{}; knot_span < number_of_non_zero_knot_spans; ++knot_span)
+          knots.emplace_back((knot_span + 0.5) / number_of_non_zero_knot_spans);
+      spline.RefineKnots(kDimension, knots); });
+}
+
+// Removes an interior knot after inserting it once more (untimed), i.e., the removal always succeeds.
+template<bool is_rational>
+void RemoveKnot(benchmark::State &state) {
+  Modify<is_rational>(state, [&] (auto &spline, int const &number_of_non_zero_knot_spans) {
+      ParametricCoordinate const knot{static_cast<double>(number_of_non_zero_knot_spans / 2) /
+                                      number_of_non_zero_knot_spans};
+      state.PauseTiming();
+      spline.InsertKnot(kDimension, knot);
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(spline.RemoveKnot(kDimension, knot, kToleranceRemoval)); });
+}
+
+template<bool is_rational>
+void ElevateDegree(benchmark::State &state) {
+  Modify<is_rational>(state, [] (auto &spline, int const &) { spline.ElevateDegree(kDimension); });
+}
+
+BENCHMARK(ConstructParameterSpace)->RangeMultiplier(2)->Range(4, 64)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(InsertKnot, false)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(InsertKnot, true)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(RefineKnots, false)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(RefineKnots, true)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(RemoveKnot, false)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(RemoveKnot, true)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(ElevateDegree, false)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+BENCHMARK_TEMPLATE(ElevateDegree, true)->RangeMultiplier(2)->Range(4, 32)->ArgName("knot_spans");
+
+}  // namespace splinelib::benchmarks::splines
@@ -20,9 +20,11 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include <utility>
 
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
 #include "Sources/Utilities/system_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 namespace splinelib::sources::input_output::iges {
 
@@ -64,6 +66,10 @@ Splines Read(String const &file_name) {
   using utilities::std_container_operations::GetValue, utilities::string_operations::ConvertToNumbers,
         utilities::string_operations::TrimCharacter;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kRead};
+#endif
+  utilities::tracing::ScopedSpan const span{"iges::Read", file_name.c_str()};
   InputStream file;
 #ifndef NDEBUG
   try {
@@ -110,6 +116,10 @@ Splines Read(String const &file_name) {
 void Write(Splines const &splines, String const &file_name, Precision const &precision, Tolerance const &tolerance) {
   using std::numeric_limits;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kWrite};
+#endif
+  utilities::tracing::ScopedSpan const span{"iges::Write", file_name.c_str()};
 #ifndef NDEBUG
   try {
 #endif
@@ -203,6 +213,9 @@ SplineEntry CreateSpline(SplineDataInt const &spline_data_int, SplineDataDouble
   using KnotVector = typename KnotVectors::value_type::element_type;
   using std::make_shared, std::move;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kParse};
+#endif
   SplineDataInt::const_iterator spline_datum_int{spline_data_int.begin() + 1};
   typename ParameterSpace::NumberOfBasisFunctions_ number_of_coordinates;
   Dimension::ForEach(0, parametric_dimensionality, [&] (Dimension const &dimension) {
@@ -20,9 +20,11 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 
 #include "Sources/Splines/spline.hpp"
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
 #include "Sources/Utilities/system_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 namespace splinelib::sources::input_output::irit {
 
@@ -53,6 +55,10 @@ void WriteSpline(OutputStream &file, SplineType const &spline, String const &poi
 }  // namespace
 
 Splines Read(String const &file_name) {
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kRead};
+#endif
+  utilities::tracing::ScopedSpan const span{"irit::Read", file_name.c_str()};
   Splines splines;
 #ifndef NDEBUG
   try {
@@ -87,6 +93,10 @@ Splines Read(String const &file_name) {
 }
 
 void Write(Splines const &splines, String const &file_name, Precision const &precision) {
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kWrite};
+#endif
+  utilities::tracing::ScopedSpan const span{"irit::Write", file_name.c_str()};
 #ifndef NDEBUG
   try {
 #endif
@@ -135,6 +145,9 @@ SplineEntry CreateSpline(StringVectorConstIterator &entry) {
   using KnotVector = typename KnotVectors::value_type::element_type;
   using Knot = typename KnotVector::Knot_;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kParse};
+#endif
   typename ParameterSpace::NumberOfBasisFunctions_ number_of_coordinates;
   Dimension::ForEach(0, parametric_dimensionality, [&] (Dimension const &dimension) {
       number_of_coordinates[dimension.Get()] = ConvertToNumber<Length>(*(entry++)); });
@@ -20,6 +20,7 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/InputOutput/xml.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/string_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 namespace splinelib::sources::input_output::operations {
 
@@ -43,6 +44,7 @@ FileFormat DetermineFileFormat(String const &file_name) {
 }
 
 Splines Read(String const &file_name) {
+  utilities::tracing::ScopedSpan const span{"operations::Read", file_name.c_str()};
   switch (DetermineFileFormat(file_name)) {
     case FileFormat::kIges:
       return iges::Read(file_name);
@@ -65,4 +67,25 @@ Splines Read(String const &file_name) {
   }
 }
 
+void Write(Splines const &splines, String const &file_name, Precision const &precision, Tolerance const &tolerance) {
+  switch (DetermineFileFormat(file_name)) {
+    case FileFormat::kIges:
+      iges::Write(splines, file_name, precision, tolerance);
+      break;
+    case FileFormat::kIrit:
+      irit::Write(splines, file_name, precision);
+      break;
+    case FileFormat::kVtk:
+#ifndef NDEBUG
+      throw RuntimeError("VTK (.vtk) files cannot be written without sampling.");
+#endif
+      break;
+    case FileFormat::kXml:
+      xml::Write(splines, file_name, precision);
+      break;
+    default:  // case FileFormat::kInvalid
+      break;
+  }
+}
+
 }  // namespace splinelib::sources::input_output::operations
@@ -23,12 +23,13 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
 
-// Input and output operations such as 1.) determining the file format and reading spline files, 2.) casting
+// Input and output operations such as 1.) determining the file format and reading or writing spline files, 2.) casting
 // shared_pointers that own spline items to shared_pointers that own actual splines, and 3.) writing coordinates
 // three-dimensionally.
 //
 // Example:
 //   Splines const &b_splines = Read(b_splines.irit);
+//   Write(b_splines, b_splines.xml);
 //   SharedPointer<BSpline<2, 3>> const &b_spline = CastToSpline<2, 3, false>(b_splines[0]);
 namespace splinelib::sources::input_output::operations {
 
@@ -42,6 +43,9 @@ using Splines = Vector<SplineEntry>;
 
 FileFormat DetermineFileFormat(String const &file_name);
 Splines Read(String const &file_name);
+// VTK files require sampling (see vtk::Sample) and cannot be written by this function.
+void Write(Splines const &splines, String const &file_name, Precision const &precision = kPrecision,
+           Tolerance const &tolerance = kEpsilon);
 
 template<int dimensionality, int parametric_dimensionality, bool is_rational>
 auto CastToSpline(SplineEntry const &spline_entry);
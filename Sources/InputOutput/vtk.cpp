@@ -16,14 +16,17 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/InputOutput/vtk.hpp"
 
 #include <algorithm>
+#include <numeric>
 
 #include "Sources/Splines/b_spline.hpp"
 #include "Sources/Splines/nurbs.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/index.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
 #include "Sources/Utilities/system_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 namespace splinelib::sources::input_output::vtk {
 
@@ -39,25 +42,29 @@ template<int parametric_dimensionality>
 void Sample(SplineEntry const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type, int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision);
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision);
 template<int parametric_dimensionality, int dimensionality>
 void Sample(SplineEntry const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type,  int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision);
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision);
 template<int parametric_dimensionality, int dimensionality, typename SplineType>
 void Sample(SplineType const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type, int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision);
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision);
 
 }  // namespace
 
 void Sample(Splines const &splines, String const &file_name,
-            NumbersOfParametricCoordinates const &numbers_of_parametric_coordinates, Tolerance const &tolerance,
-            Precision const &precision) {
-  using std::get, utilities::system_operations::OutputStream;
+            NumbersOfParametricCoordinates const &numbers_of_parametric_coordinates,
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision) {
+  using std::accumulate, utilities::system_operations::OutputStream;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kSample};
+#endif
+  utilities::tracing::ScopedSpan const span{"vtk::Sample", file_name.c_str()};
 #ifndef NDEBUG
   try {
 #endif
@@ -71,51 +78,82 @@ void Sample(Splines const &splines, String const &file_name,
     OutputStream file{utilities::system_operations::Open<OutputStream,
                                                          utilities::system_operations::kModeOut>(file_name)};
     file << "# vtk DataFile Version 3.0\nSplines from Splinelib\nASCII\n\nDATASET UNSTRUCTURED_GRID";
-    int total_number_of_points{}, total_number_of_cells{}, cell_list_size{};
-    String points{}, cells{}, cell_types{};
-    ScalarIndex::ForEach(0, number_of_splines, [&] (ScalarIndex const &spline_index) {
-        ScalarIndex::Type_ const &spline_index_value = spline_index.Get();
-        SplineEntry const &spline = splines[spline_index_value];
-        int const &parametric_dimensionality = spline->parametric_dimensionality_;
-        NumberOfParametricCoordinates const &number_of_parametric_coordinates =
-            numbers_of_parametric_coordinates[spline_index_value];
+    // Every spline is written to its own strings.  The indices of its points are shifted by the numbers of points of
+    // all preceding splines, which are known in advance, so that the output does not depend on the number of threads.
+    Vector<int> first_points(number_of_splines), numbers_of_cells(number_of_splines),
+                cell_list_sizes(number_of_splines);
+    int total_number_of_points{};
+    for (int spline_index{}; spline_index < number_of_splines; ++spline_index) {
+      NumberOfParametricCoordinates const &number_of_parametric_coordinates =
+          numbers_of_parametric_coordinates[spline_index];
+      first_points[spline_index] = total_number_of_points;
+      total_number_of_points += accumulate(number_of_parametric_coordinates.begin(),
+          number_of_parametric_coordinates.end(), 1, [] (int const &number_of_points, Length const &length) {
+              return (number_of_points * length.Get()); });
+    }
+    StringVector points(number_of_splines), cells(number_of_splines), cell_types(number_of_splines);
+    NumberOfThreads const number_of_threads_per_spline{std::max(number_of_threads.Get() /
+                                                                    std::max(number_of_splines, 1), 1)};
+    utilities::system_operations::ForEachBlockInParallel(0, number_of_splines, number_of_threads,
+                                                         [&] (int const &first, int const &behind) {
+      ScalarIndex::ForEach(first, behind, [&] (ScalarIndex const &spline_index) {
+          ScalarIndex::Type_ const &spline_index_value = spline_index.Get();
+          utilities::tracing::ScopedSpan const span{"vtk::Sample (spline)", "spline", spline_index_value};
+          SplineEntry const &spline = splines[spline_index_value];
+          int const &parametric_dimensionality = spline->parametric_dimensionality_;
+          NumberOfParametricCoordinates const &number_of_parametric_coordinates =
+              numbers_of_parametric_coordinates[spline_index_value];
+          int first_point{first_points[spline_index_value]};
+          int &number_of_cells = numbers_of_cells[spline_index_value],
+              &cell_list_size = cell_list_sizes[spline_index_value];
+          String &spline_points = points[spline_index_value], &spline_cells = cells[spline_index_value],
+                 &spline_cell_types = cell_types[spline_index_value];
 #ifndef NDEBUG
-        Message const spline_string{"For spline number " + to_string(spline_index_value) + ": "};
-
-        int const &number_of_parametric_coordinates_size = number_of_parametric_coordinates.size();
-        try {
-          if (number_of_parametric_coordinates_size != parametric_dimensionality)
-              throw RuntimeError("For splines of parametric dimensionality " +
-                        to_string(parametric_dimensionality) + " numbers of parametric coordinates must be chosen, but "
-                        "only " + to_string(number_of_parametric_coordinates_size) + " were provided.");
+          Message const spline_string{"For spline number " + to_string(spline_index_value) + ": "};
+
+          int const &number_of_parametric_coordinates_size = number_of_parametric_coordinates.size();
+          try {
+            if (number_of_parametric_coordinates_size != parametric_dimensionality)
+                throw RuntimeError("For splines of parametric dimensionality " + to_string(parametric_dimensionality)
+                          + " numbers of parametric coordinates must be chosen, but only " +
+                              to_string(number_of_parametric_coordinates_size) + " were provided.");
 #endif
-          switch (parametric_dimensionality) {
-            case 1:
-              Sample<1>(spline, number_of_parametric_coordinates, 2, "3", total_number_of_points, points,
-                        total_number_of_cells, cells, cell_list_size, cell_types, tolerance, precision);
-              break;
-            case 2:
-              Sample<2>(spline, number_of_parametric_coordinates, 4, "9", total_number_of_points, points,
-                        total_number_of_cells, cells, cell_list_size, cell_types, tolerance, precision);
-              break;
-            case 3:
-              Sample<3>(spline, number_of_parametric_coordinates, 8, "12", total_number_of_points, points,
-                        total_number_of_cells, cells, cell_list_size, cell_types, tolerance, precision);
-              break;
-            default:
+            switch (parametric_dimensionality) {
+              case 1:
+                Sample<1>(spline, number_of_parametric_coordinates, 2, "3", first_point, spline_points,
+                          number_of_cells, spline_cells, cell_list_size, spline_cell_types,
+                          number_of_threads_per_spline, tolerance, precision);
+                break;
+              case 2:
+                Sample<2>(spline, number_of_parametric_coordinates, 4, "9", first_point, spline_points,
+                          number_of_cells, spline_cells, cell_list_size, spline_cell_types,
+                          number_of_threads_per_spline, tolerance, precision);
+                break;
+              case 3:
+                Sample<3>(spline, number_of_parametric_coordinates, 8, "12", first_point, spline_points,
+                          number_of_cells, spline_cells, cell_list_size, spline_cell_types,
+                          number_of_threads_per_spline, tolerance, precision);
+                break;
+              default:
 #ifndef NDEBUG
-              throw RuntimeError("The spline's parametric dimensionality (" +
-                        to_string(parametric_dimensionality) + ") must be larger than 0 and currently less than 4.");
+                throw RuntimeError("The spline's parametric dimensionality (" +
+                          to_string(parametric_dimensionality) + ") must be larger than 0 and currently less than 4.");
 #endif
-              break;
-          }
+                break;
+            }
 #ifndef NDEBUG
-        } catch (RuntimeError const &exception) { throw RuntimeError(spline_string + exception.what()); }
+          } catch (RuntimeError const &exception) { throw RuntimeError(spline_string + exception.what()); }
 #endif
+      });
     });
-    file << "\nPOINTS " << total_number_of_points << " double" << points;
-    file << "\n\nCELLS " << total_number_of_cells << " " << cell_list_size << cells;
-    file << "\n\nCELL_TYPES " << total_number_of_cells << cell_types;
+    int const &total_number_of_cells = accumulate(numbers_of_cells.begin(), numbers_of_cells.end(), 0),
+              &cell_list_size = accumulate(cell_list_sizes.begin(), cell_list_sizes.end(), 0);
+    file << "\nPOINTS " << total_number_of_points << " double";
+    for (String const &spline_points : points) file << spline_points;
+    file << "\n\nCELLS " << total_number_of_cells << " " << cell_list_size;
+    for (String const &spline_cells : cells) file << spline_cells;
+    file << "\n\nCELL_TYPES " << total_number_of_cells;
+    for (String const &spline_cell_types : cell_types) file << spline_cell_types;
 #ifndef NDEBUG
   } catch (RuntimeError const &exception) { Throw(exception, "splinelib::sources::input_output::vtk::Sample"); }
 #endif
@@ -127,23 +165,23 @@ template<int parametric_dimensionality>
 void Sample(SplineEntry const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type, int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision) {
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision) {
   int const &dimensionality = spline->dimensionality_;
   switch (dimensionality) {
     case 1:
       Sample<parametric_dimensionality, 1>(spline, number_of_parametric_coordinates, number_of_vertices_per_cell,
                                            cell_type, total_number_of_points, points, total_number_of_cells, cells,
-                                           cell_list_size, cell_types, tolerance, precision);
+                                           cell_list_size, cell_types, number_of_threads, tolerance, precision);
       break;
     case 2:
       Sample<parametric_dimensionality, 2>(spline, number_of_parametric_coordinates, number_of_vertices_per_cell,
                                            cell_type, total_number_of_points, points, total_number_of_cells, cells,
-                                           cell_list_size, cell_types, tolerance, precision);
+                                           cell_list_size, cell_types, number_of_threads, tolerance, precision);
       break;
     case 3:
       Sample<parametric_dimensionality, 3>(spline, number_of_parametric_coordinates, number_of_vertices_per_cell,
                                            cell_type, total_number_of_points, points, total_number_of_cells, cells,
-                                           cell_list_size, cell_types, tolerance, precision);
+                                           cell_list_size, cell_types, number_of_threads, tolerance, precision);
       break;
     default:
 #ifndef NDEBUG
@@ -158,19 +196,19 @@ template<int parametric_dimensionality, int dimensionality>
 void Sample(SplineEntry const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type, int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision) {
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision) {
   using std::static_pointer_cast;
 
   if (spline->is_rational_) {
     Sample<parametric_dimensionality, dimensionality>(*static_pointer_cast<splines::Nurbs<parametric_dimensionality,
         dimensionality>>(spline), number_of_parametric_coordinates, number_of_vertices_per_cell, cell_type,
-            total_number_of_points, points, total_number_of_cells, cells, cell_list_size, cell_types, tolerance,
-                precision);
+            total_number_of_points, points, total_number_of_cells, cells, cell_list_size, cell_types,
+                number_of_threads, tolerance, precision);
   } else {
     Sample<parametric_dimensionality, dimensionality>(*static_pointer_cast<splines::BSpline<parametric_dimensionality,
         dimensionality>>(spline), number_of_parametric_coordinates, number_of_vertices_per_cell, cell_type,
-            total_number_of_points, points, total_number_of_cells, cells, cell_list_size, cell_types, tolerance,
-                precision);
+            total_number_of_points, points, total_number_of_cells, cells, cell_list_size, cell_types,
+                number_of_threads, tolerance, precision);
   }
 }
 
@@ -178,7 +216,7 @@ template<int parametric_dimensionality, int dimensionality, typename SplineType>
 void Sample(SplineType const &spline, NumberOfParametricCoordinates const &number_of_parametric_coordinates,
             int const &number_of_vertices_per_cell, String const &cell_type, int &total_number_of_points,
             String &points, int &total_number_of_cells, String &cells, int &cell_list_size, String &cell_types,
-            Tolerance const &tolerance, Precision const &precision) {
+            NumberOfThreads const &number_of_threads, Tolerance const &tolerance, Precision const &precision) {
   using Coordinates = typename SplineType::Base_::Coordinates_;
   using Index = Index<parametric_dimensionality>;
   using IndexLength = typename Index::Length_;
@@ -190,7 +228,7 @@ void Sample(SplineType const &spline, NumberOfParametricCoordinates const &numbe
   IndexLength number_of_vertices;
   std::copy(number_of_parametric_coordinates.begin(), number_of_parametric_coordinates.end(),
             number_of_vertices.begin());
-  Coordinates const &current_points = spline.Sample(number_of_vertices, tolerance);
+  Coordinates const &current_points = spline.Sample(number_of_vertices, number_of_threads, tolerance);
   for_each(current_points.begin(), current_points.end(), [&] (typename Coordinates::value_type const &point) {
     Append(points, "\n", operations::WriteCoordinate3d(Write<StringArray<dimensionality>>(point, precision), " "));
   });
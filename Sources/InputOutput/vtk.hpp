@@ -29,9 +29,12 @@ namespace splinelib::sources::input_output::vtk {
 
 using NumbersOfParametricCoordinates = Vector<Vector<Length>>;
 
+// The splines (and, if threads are left, the coordinates of each spline) are sampled in parallel; the file written
+// does not depend on the number of threads.
 void Sample(Splines const &splines, String const &file_name,
             NumbersOfParametricCoordinates const &numbers_of_parametric_coordinates,
-            Tolerance const &tolerance = kEpsilon, Precision const &precision = kPrecision);
+            NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon,
+            Precision const &precision = kPrecision);
 
 }  // namespace splinelib::sources::input_output::vtk
 
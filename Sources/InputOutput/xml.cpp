@@ -22,8 +22,10 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include <pugixml.hpp>  // Cf. documentation at <https://pugixml.org/docs/manual.html>.
 #include "Sources/Splines/spline.hpp"
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 namespace splinelib::sources::input_output::xml {
 
@@ -53,6 +55,10 @@ void Write(Node &spline_node, SplineType const &spline, String const &names, Pre
 }  // namespace
 
 Splines Read(String const &file_name) {
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kRead};
+#endif
+  utilities::tracing::ScopedSpan const span{"xml::Read", file_name.c_str()};
   Splines splines;
 #ifndef NDEBUG
   try {
@@ -95,6 +101,10 @@ Splines Read(String const &file_name) {
 }
 
 void Write(Splines const &splines, String const &file_name, Precision const &precision) {
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kWrite};
+#endif
+  utilities::tracing::ScopedSpan const span{"xml::Write", file_name.c_str()};
 #ifndef NDEBUG
   try {
 #endif
@@ -142,6 +152,9 @@ SplineEntry CreateSpline(Node const &spline_entry) {
   using KnotVectors = typename ParameterSpace::KnotVectors_;
   using KnotVector = typename KnotVectors::value_type::element_type;
 
+#ifdef SPLINELIB_INSTRUMENTATION
+  utilities::instrumentation::ScopedTimer const timer{utilities::instrumentation::Phase::kParse};
+#endif
   Node child{spline_entry.child("kntVecs").first_child()};
   KnotVectors knot_vectors;
   Dimension::ForEach(0, parametric_dimensionality, [&] (Dimension const &dimension) {
@@ -0,0 +1,80 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef SOURCES_MODELS_SYNTHETIC_HPP_
+#define SOURCES_MODELS_SYNTHETIC_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "Sources/Models/rectangular.hpp"
+#include "Sources/ParameterSpaces/parameter_space.hpp"
+#include "Sources/Splines/b_spline.hpp"
+#include "Sources/Splines/nurbs.hpp"
+#include "Sources/Splines/spline_item.hpp"
+#include "Sources/Utilities/index.hpp"
+#include "Sources/Utilities/named_type.hpp"
+
+// Generates synthetic (multi-patch) spline models of arbitrary size for scale and stress testing.  Each patch covers an
+// axis-aligned unit box, has knot vectors with uniform, graded (refined towards the first knot), or random interior
+// breakpoints of a given multiplicity and, if rational, random weights.  The control points are placed at the Greville
+// abscissae so that the patches of a model are adjacent.  Random numbers are drawn with a fixed seed for each patch,
+// i.e., the same arguments always yield the same model.
+//
+// Example:
+//   Splines const &volumes = GenerateModel<3, 3, true>({Length{10}, Length{10}, Length{10}}, {Length{8}, Length{8},
+//       Length{8}}, {Degree{2}, Degree{3}, Degree{2}}, {Multiplicity{1}, Multiplicity{2}, Multiplicity{1}},
+//           KnotDistribution::kRandom);  // 1,000 NURBS volumes with 1,800 control points each.
+//   input_output::operations::Write(volumes, "volumes.xml");
+namespace splinelib::sources::models::synthetic {
+
+enum class KnotDistribution { kUniform, kGraded, kRandom };
+template<int parametric_dimensionality>
+using Degrees = rectangular::Degrees<parametric_dimensionality>;
+template<int parametric_dimensionality>
+using InteriorMultiplicities = Array<Multiplicity, parametric_dimensionality>;
+template<int parametric_dimensionality>
+using NumbersOfNonZeroKnotSpans = rectangular::NumbersOfNonZeroKnotSpans<parametric_dimensionality>;
+template<int parametric_dimensionality>
+using NumbersOfPatches = Array<Length, parametric_dimensionality>;
+template<int parametric_dimensionality>
+using Position = typename utilities::Index<parametric_dimensionality>::Value_;
+using RandomNumberGenerator = std::mt19937_64;
+using Seed = RandomNumberGenerator::result_type;
+using Splines = Vector<SharedPointer<splines::SplineItem>>;
+
+constexpr Seed const kSeed{};
+
+template<int parametric_dimensionality, int geometric_dimensionality, bool is_rational>
+auto GeneratePatch(NumbersOfNonZeroKnotSpans<parametric_dimensionality> const &numbers_of_non_zero_knot_spans,
+                   Degrees<parametric_dimensionality> const &degrees,
+                   InteriorMultiplicities<parametric_dimensionality> const &interior_multiplicities,
+                   KnotDistribution const &knot_distribution,
+                   Position<parametric_dimensionality> const &position = Position<parametric_dimensionality>{},
+                   Seed const &seed = kSeed);
+template<int parametric_dimensionality, int geometric_dimensionality, bool is_rational>
+Splines GenerateModel(NumbersOfPatches<parametric_dimensionality> const &numbers_of_patches,
+                      NumbersOfNonZeroKnotSpans<parametric_dimensionality> const &numbers_of_non_zero_knot_spans,
+                      Degrees<parametric_dimensionality> const &degrees,
+                      InteriorMultiplicities<parametric_dimensionality> const &interior_multiplicities,
+                      KnotDistribution const &knot_distribution, Seed const &seed = kSeed);
+
+#include "Sources/Models/synthetic.inc"
+
+}  // namespace splinelib::sources::models::synthetic
+
+#endif  // SOURCES_MODELS_SYNTHETIC_HPP_
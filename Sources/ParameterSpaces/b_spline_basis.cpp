@@ -0,0 +1,154 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "Sources/ParameterSpaces/b_spline_basis.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "Sources/ParameterSpaces/knot_vector.hpp"
+#include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/numeric_operations.hpp"
+
+namespace splinelib::sources::parameter_spaces {
+
+BSplineBasis::BSplineBasis(KnotVector const &knot_vector, Degree degree, Tolerance const &tolerance)
+    : degree_(std::move(degree)) {
+#ifndef NDEBUG
+  try {
+    utilities::numeric_operations::ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) {
+    Throw(exception, "splinelib::sources::parameter_spaces::BSplineBasis::BSplineBasis");
+  }
+#endif
+  int const number_of_knots{knot_vector.GetSize()};
+  knots_.reserve(number_of_knots);
+  Index::ForEach(0, number_of_knots, [&] (Index const &knot) { knots_.emplace_back(knot_vector[knot]); });
+  last_knot_ = number_of_knots;
+  while ((last_knot_ > 0) && knot_vector.DoesParametricCoordinateEqualBack(knots_[last_knot_ - 1], tolerance)) {
+    --last_knot_;
+  }
+  Degree::Type_ const &degree_value = degree_.Get();
+  knot_difference_inverses_.assign(degree_value * number_of_knots, Type_{});
+  for (int degree_minus_one = 0; degree_minus_one < degree_value; ++degree_minus_one) {
+    int const offset{degree_minus_one * number_of_knots}, current_degree{degree_minus_one + 1};
+    for (int knot = 0; knot < (number_of_knots - current_degree); ++knot) {
+      ParametricCoordinate const knot_difference{knots_[knot + current_degree] - knots_[knot]};
+      if (!IsEqual(knot_difference, ParametricCoordinate{}, tolerance))
+          knot_difference_inverses_[offset + knot] = (1.0 / knot_difference.Get());
+    }
+  }
+}
+
+bool IsEqual(BSplineBasis const &lhs, BSplineBasis const &rhs, Tolerance const &tolerance) {
+  using Type = BSplineBasis::Type_;
+  using utilities::std_container_operations::DoesContainEqualValues;
+
+#ifndef NDEBUG
+  try {
+    utilities::numeric_operations::ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) {
+    Throw(exception, "splinelib::sources::parameter_spaces::IsEqual::BSplineBasis");
+  }
+#endif
+  return ((lhs.degree_ == rhs.degree_) && DoesContainEqualValues(lhs.knots_, rhs.knots_, tolerance) &&
+          (lhs.last_knot_ == rhs.last_knot_) && std::equal(lhs.knot_difference_inverses_.begin(),
+              lhs.knot_difference_inverses_.end(), rhs.knot_difference_inverses_.begin(),
+                  rhs.knot_difference_inverses_.end(), [&] (Type const &lhs_inverse, Type const &rhs_inverse) {
+                      return utilities::numeric_operations::IsEqual(lhs_inverse, rhs_inverse, tolerance); }));
+}
+
+bool operator==(BSplineBasis const &lhs, BSplineBasis const &rhs) {
+  return IsEqual(lhs, rhs);
+}
+
+BSplineBasis::Type_ BSplineBasis::operator()(KnotSpan const &start_of_support,
+    ParametricCoordinate const &parametric_coordinate, Tolerance const &tolerance) const {
+#ifndef NDEBUG
+  Message const kName{"splinelib::sources::parameter_spaces::BSplineBasis::operator()"};
+
+  try {
+    ThrowIfStartOfSupportIsInvalid(start_of_support);
+    utilities::numeric_operations::ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) { Throw(exception, kName); }
+    catch (OutOfRange const &exception) { Throw(exception, kName); }
+#endif
+  return Evaluate(start_of_support, parametric_coordinate, Derivative{}, tolerance);
+}
+
+BSplineBasis::Type_ BSplineBasis::operator()(KnotSpan const &start_of_support,
+    ParametricCoordinate const &parametric_coordinate, Derivative const &derivative, Tolerance const &tolerance) const {
+#ifndef NDEBUG
+  Message const kName{"splinelib::sources::parameter_spaces::BSplineBasis::operator()"};
+
+  try {
+    ThrowIfStartOfSupportIsInvalid(start_of_support);
+    utilities::numeric_operations::ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) { Throw(exception, kName); }
+    catch (OutOfRange const &exception) { Throw(exception, kName); }
+#endif
+  return Evaluate(start_of_support, parametric_coordinate, derivative, tolerance);
+}
+
+// The basis functions N_{i,0}, ..., N_{i+p,0} are overwritten by N_{i,1}, ..., N_{i+p-1,1} and so on until only N_{i,p}
+// remains, whereby the (at most p) highest degrees are differentiated.
+BSplineBasis::Type_ BSplineBasis::Evaluate(KnotSpan const &start_of_support,
+    ParametricCoordinate const &parametric_coordinate, Derivative const &derivative, Tolerance const &tolerance) const {
+  Degree::Type_ const &degree = degree_.Get();
+  Derivative::Type_ const &derivative_value = derivative.Get();
+  if (derivative_value > degree) return Type_{};
+
+  KnotSpan::Type_ const &start = start_of_support.Get();
+  int const number_of_knots{static_cast<int>(knots_.size())}, highest_undifferentiated_degree{degree -
+                                                                                              derivative_value};
+  Types_ basis_functions(degree + 1);
+  for (int current_knot = 0; current_knot <= degree; ++current_knot) {
+    int const knot{start + current_knot};
+    if (IsInSupport(knot, knot + 1, parametric_coordinate, tolerance)) basis_functions[current_knot] = Type_{1.0};
+  }
+  for (int current_degree = 1; current_degree <= degree; ++current_degree) {
+    int const offset{(current_degree - 1) * number_of_knots};
+    for (int current_knot = 0; current_knot <= (degree - current_degree); ++current_knot) {
+      int const knot{start + current_knot}, end_knot{knot + current_degree + 1};
+      Type_ &basis_function = basis_functions[current_knot];
+      if (IsInSupport(knot, end_knot, parametric_coordinate, tolerance)) {
+        Type_ const left{knot_difference_inverses_[offset + knot] * basis_function},
+                    right{knot_difference_inverses_[offset + knot + 1] * basis_functions[current_knot + 1]};
+        basis_function = ((current_degree > highest_undifferentiated_degree) ? (current_degree * (left - right)) :
+            (((parametric_coordinate - knots_[knot]).Get() * left) +
+             ((knots_[end_knot] - parametric_coordinate).Get() * right)));
+      } else {
+        basis_function = Type_{};
+      }
+    }
+  }
+  return basis_functions[0];
+}
+
+bool BSplineBasis::IsInSupport(int const &start_knot, int const &end_knot,
+    ParametricCoordinate const &parametric_coordinate, Tolerance const &tolerance) const {
+  ParametricCoordinate const &end = knots_[end_knot];
+  return ((IsGreaterOrEqual(parametric_coordinate, knots_[start_knot], tolerance) && IsLess(parametric_coordinate, end,
+               tolerance)) || (IsEqual(parametric_coordinate, end, tolerance) && (end_knot >= last_knot_)));
+}
+
+#ifndef NDEBUG
+void BSplineBasis::ThrowIfStartOfSupportIsInvalid(KnotSpan const &start_of_support) const {
+  KnotSpan::ThrowIfNamedIntegerIsOutOfBounds(start_of_support, (static_cast<int>(knots_.size()) - 1) -
+                                                                   (degree_.Get() + 1));
+}
+#endif
+
+}  // namespace splinelib::sources::parameter_spaces
@@ -0,0 +1,92 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef SOURCES_PARAMETERSPACES_B_SPLINE_BASIS_HPP_
+#define SOURCES_PARAMETERSPACES_B_SPLINE_BASIS_HPP_
+
+#include "Sources/ParameterSpaces/b_spline_basis_function.hpp"
+#include "Sources/ParameterSpaces/knot_vector.hpp"
+#include "Sources/Utilities/named_type.hpp"
+#include "Sources/Utilities/std_container_operations.hpp"
+
+namespace splinelib::sources::parameter_spaces {
+
+// BSplineBases comprise all n B-spline basis functions N_{i,p} of degree p corresponding to some knot vector.  In
+// contrast to BSplineBasisFunctions, the recurrence formula (see NURBS book Eq. (2.5)) is not implemented as a data
+// structure of (lower-degree) basis functions.  Instead, the knots and — for all degrees q in {1, ..., p} — the
+// inverses of the knot differences 1/(u_{i+q}-u_i) are stored contiguously (one array each), so that no basis function
+// has to be allocated.  Note that 1/0 := 0.
+//
+// Example (see NURBS book Exa. 2.1):
+//   KnotVector::Knot_ const k0_0{0.0}, k1_0{1.0};
+//   KnotVector const kKnotVector{k0_0, k0_0, k0_0, k1_0, k1_0, k1_0};
+//   ParametricCoordinate const k0_25{0.25};
+//   BSplineBasis const basis(kKnotVector, Degree{2});
+//   BSplineBasis::Type_ const &evaluated = basis(KnotSpan{}, k0_25),  // N_{0,2}(0.25) = 0.5625.
+//                             &first_derivative = basis(KnotSpan{}, k0_25, Derivative{1});  // N_{0,2}'(0.25) = -1.5.
+class BSplineBasis {
+ public:
+  using Type_ = BSplineBasisFunction::Type_;
+
+  BSplineBasis() = default;
+  BSplineBasis(KnotVector const &knot_vector, Degree degree, Tolerance const &tolerance = kEpsilon);
+  BSplineBasis(BSplineBasis const &other) = default;
+  BSplineBasis(BSplineBasis &&other) noexcept = default;
+  BSplineBasis & operator=(BSplineBasis const &rhs) = default;
+  BSplineBasis & operator=(BSplineBasis &&rhs) noexcept = default;
+  ~BSplineBasis() = default;
+
+  // Comparison based on tolerance.
+  friend bool IsEqual(BSplineBasis const &lhs, BSplineBasis const &rhs, Tolerance const &tolerance);
+  // Comparison based on numeric_operations::GetEpsilon<Tolerance>().
+  friend bool operator==(BSplineBasis const &lhs, BSplineBasis const &rhs);
+  // Evaluates the basis function N_{i,p} whose support starts at the ith knot.
+  Type_ operator()(KnotSpan const &start_of_support, ParametricCoordinate const &parametric_coordinate,
+                   Tolerance const &tolerance = kEpsilon) const;
+  Type_ operator()(KnotSpan const &start_of_support, ParametricCoordinate const &parametric_coordinate,
+                   Derivative const &derivative, Tolerance const &tolerance = kEpsilon) const;
+
+ private:
+  using Knots_ = KnotVector::Knots_;
+  using Types_ = Vector<Type_>;
+
+  // Triangular scheme of the recurrence formula due to DeBoor, Cox, and Mansfield (see NURBS book Eqs. (2.5) & (2.9)).
+  Type_ Evaluate(KnotSpan const &start_of_support, ParametricCoordinate const &parametric_coordinate,
+                 Derivative const &derivative, Tolerance const &tolerance) const;
+  // The last knot is treated in a special way (cf. KnotVector::FindSpan).
+  bool IsInSupport(int const &start_knot, int const &end_knot, ParametricCoordinate const &parametric_coordinate,
+                   Tolerance const &tolerance) const;
+
+#ifndef NDEBUG
+  void ThrowIfStartOfSupportIsInvalid(KnotSpan const &start_of_support) const;
+#endif
+
+  Degree degree_;
+  Knots_ knots_;
+  // Index of the first knot that equals the last knot.
+  int last_knot_{};
+  // Inverse 1/(u_{i+q}-u_i) is stored at position (q-1)*(m+1)+i.
+  Types_ knot_difference_inverses_;
+};
+
+bool IsEqual(BSplineBasis const &lhs, BSplineBasis const &rhs, Tolerance const &tolerance = kEpsilon);
+bool operator==(BSplineBasis const &lhs, BSplineBasis const &rhs);
+
+template<int parametric_dimensionality>
+using BSplineBases = Array<BSplineBasis, parametric_dimensionality>;
+
+}  // namespace splinelib::sources::parameter_spaces
+
+#endif  // SOURCES_PARAMETERSPACES_B_SPLINE_BASIS_HPP_
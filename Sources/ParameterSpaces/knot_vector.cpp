@@ -16,11 +16,11 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/ParameterSpaces/knot_vector.hpp"
 
 #include <algorithm>
-#include <functional>
 #include <iterator>
 #include <utility>
 
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 
@@ -28,6 +28,9 @@ namespace splinelib::sources::parameter_spaces {
 
 using Knot = KnotVector::Knot_;
 using std::move, std::to_string;
+#ifdef SPLINELIB_INSTRUMENTATION
+using utilities::instrumentation::Count, utilities::instrumentation::Counter;
+#endif
 #ifndef NDEBUG
 using utilities::numeric_operations::ThrowIfToleranceIsNegative;
 #endif
@@ -42,6 +45,7 @@ KnotVector::KnotVector(Knots_ knots, Tolerance const &tolerance) : knots_(move(k
   } catch (DomainError const &exception) { Throw(exception, kName); }
     catch (InvalidArgument const &exception) { Throw(exception, kName); }
 #endif
+  DetermineBreakpoints(tolerance);
 }
 
 bool IsEqual(KnotVector const &lhs, KnotVector const &rhs, Tolerance const &tolerance) {
@@ -74,6 +78,10 @@ int KnotVector::GetSize() const {
   return knots_.size();
 }
 
+Span<KnotVector::Knot_ const> KnotVector::GetKnots() const {
+  return knots_;
+}
+
 Knot const & KnotVector::GetFront() const {
   return knots_[0];
 }
@@ -82,6 +90,22 @@ Knot const & KnotVector::GetBack() const {
   return knots_[knots_.size() - 1];
 }
 
+KnotVector::Type_ KnotVector::GetUniformKnotSpacing() const {
+  return ((uniform_runs_.size() == 1) ? std::get<2>(uniform_runs_[0]) : Type_{});
+}
+
+KnotVector::Type_ KnotVector::GetUniformKnotSpacing(KnotSpan const &knot_span, int const &degree) const {
+  if (longest_uniform_run_ < (2 * degree - 1)) return Type_{};
+  int const &knot = knot_span.Get(), first_knot{knot - degree + 1}, last_knot{knot + degree};
+  auto const &[first_breakpoint, last_breakpoint, knot_spacing] = *FindUniformRun(knot, [&] (int const &breakpoint) {
+      return first_knots_[breakpoint]; });
+  if ((first_knot < first_knots_[first_breakpoint]) || (last_knot >= first_knots_[last_breakpoint + 1])) return Type_{};
+  // The knots of a run are equidistant unique knots (possibly repeated), so they are distinct iff they span 2p-1 knot
+  // spacings h.
+  return (((knots_[last_knot] - knots_[first_knot]).Get() > ((2 * degree - 1.5) * knot_spacing)) ? knot_spacing
+                                                                                                 : Type_{});
+}
+
 bool KnotVector::DoesParametricCoordinateEqualBack(ParametricCoordinate const &parametric_coordinate,
                                                    Tolerance const &tolerance) const {
 #ifndef NDEBUG
@@ -123,15 +147,80 @@ KnotSpan KnotVector::FindSpan(ParametricCoordinate const &parametric_coordinate,
     catch (InvalidArgument const &exception) { Throw(exception, kName); }
     catch (OutOfRange const &exception) { Throw(exception, kName); }
 #endif
+#ifdef SPLINELIB_INSTRUMENTATION
+  Count(Counter::kSpanSearches);
+#endif
+  if (!uniform_runs_.empty()) {
+    // Rounding errors and the tolerance can only shift the estimated knot span to a neighboring one (possibly of the
+    // neighboring run).
+    auto const &[first_breakpoint, last_breakpoint, knot_spacing] = *FindUniformRun(parametric_coordinate,
+        [&] (int const &breakpoint) { return unique_knots_[breakpoint]; });
+    int const breakpoint{first_breakpoint + static_cast<int>((parametric_coordinate - unique_knots_[first_breakpoint])
+                                                                 .Get() / knot_spacing)};
+    return SearchSpan(parametric_coordinate, KnotSpan{first_knots_[std::clamp(breakpoint, first_breakpoint,
+                          last_breakpoint - 1) + 1] - 1}, tolerance);
+  }
   ConstIterator_ const &knots_begin = knots_.begin(), &knots_end = knots_.end();
-  std::function<bool(ParametricCoordinate, Knot_)> const &is_less =
-      [&] (Knot_ const &knot, ParametricCoordinate const &parametric_coordinate) {
-          return IsLess(knot, parametric_coordinate, tolerance); };
+  auto const &is_less = [&] (Knot_ const &lhs, Knot_ const &rhs) { return IsLess(lhs, rhs, tolerance); };
   return KnotSpan{static_cast<int>(std::distance(knots_begin, DoesParametricCoordinateEqualBack(parametric_coordinate,
                       tolerance) ? std::lower_bound(knots_begin, knots_end, parametric_coordinate, is_less) :
                                    std::upper_bound(knots_begin, knots_end, parametric_coordinate, is_less)) - 1)};
 }
 
+KnotSpan KnotVector::FindSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &knot_span_hint,
+                              Tolerance const &tolerance) const {
+#ifndef NDEBUG
+  Message const kName{"splinelib::sources::parameter_spaces::KnotVector::FindSpan"};
+
+  try {
+    ThrowIfToleranceIsNegative(tolerance);
+    ThrowIfParametricCoordinateIsOutsideScope(parametric_coordinate, tolerance);
+    ThrowIfTooSmallOrNotNonDecreasing(tolerance);
+  } catch (DomainError const &exception) { Throw(exception, kName); }
+    catch (InvalidArgument const &exception) { Throw(exception, kName); }
+    catch (OutOfRange const &exception) { Throw(exception, kName); }
+#endif
+#ifdef SPLINELIB_INSTRUMENTATION
+  Count(Counter::kSpanSearches);
+#endif
+  return SearchSpan(parametric_coordinate, knot_span_hint, tolerance);
+}
+
+KnotSpan KnotVector::SearchSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &knot_span_hint,
+                                Tolerance const &tolerance) const {
+  // Knots are behind the parametric coordinate u if they are greater than u (or not less than u if u equals the last
+  // knot), so the knot span is the last knot not behind u (cf. FindSpan without hint).
+  bool const is_parametric_coordinate_back{DoesParametricCoordinateEqualBack(parametric_coordinate, tolerance)};
+  auto const &is_behind = [&] (int const &knot) {
+      Knot_ const &current_knot = knots_[knot];
+      return (is_parametric_coordinate_back ? !IsLess(current_knot, parametric_coordinate, tolerance)
+                                            : IsLess(parametric_coordinate, current_knot, tolerance)); };
+  int const number_of_knots{static_cast<int>(knots_.size())};
+  // Gallop from the hint until the first knot behind u is bracketed by [first, behind].
+  int first{std::clamp(knot_span_hint.Get(), 0, number_of_knots - 1)}, behind{first + 1};
+  if (is_behind(first)) {
+    behind = first;
+    for (int step{1}; (first > 0) && is_behind(first); step *= 2) {
+      behind = first;
+      first = std::max(first - step, 0);
+    }
+  } else {
+    for (int step{1}; (behind < number_of_knots) && !is_behind(behind); step *= 2) {
+      first = behind;
+      behind = std::min(behind + step, number_of_knots);
+    }
+  }
+  while (first < behind) {
+    int const middle{first + (behind - first) / 2};
+    if (is_behind(middle)) {
+      behind = middle;
+    } else {
+      first = (middle + 1);
+    }
+  }
+  return KnotSpan{first - 1};
+}
+
 Multiplicity KnotVector::DetermineMultiplicity(ParametricCoordinate const &parametric_coordinate,
                                                Tolerance const &tolerance) const {
 #ifndef NDEBUG
@@ -143,6 +232,12 @@ Multiplicity KnotVector::DetermineMultiplicity(ParametricCoordinate const &param
   } catch (DomainError const &exception) { Throw(exception, kName); }
     catch (InvalidArgument const &exception) { Throw(exception, kName); }
 #endif
+  if (AreBreakpointsDeterminedWith(tolerance)) {
+    int const breakpoint{FindBreakpoint(parametric_coordinate)};
+    if ((breakpoint == static_cast<int>(unique_knots_.size())) ||
+        !IsEqual(unique_knots_[breakpoint], parametric_coordinate, tolerance)) return Multiplicity{};
+    return Multiplicity{first_knots_[breakpoint + 1] - first_knots_[breakpoint]};
+  }
   return Multiplicity{static_cast<int>(std::count_if(knots_.begin(), knots_.end(), [&] (Knot_ const &current_knot) {
                                            return IsEqual(current_knot, parametric_coordinate, tolerance); }))};
 }
@@ -155,6 +250,7 @@ KnotVector::Knots_ KnotVector::GetUniqueKnots(Tolerance const &tolerance) const
     Throw(exception, "splinelib::sources::parameter_spaces::KnotVector::GetUniqueKnots");
   }
 #endif
+  if (AreBreakpointsDeterminedWith(tolerance)) return unique_knots_;
   Knots_ unique_knots;
   std::unique_copy(knots_.begin(), knots_.end(), std::back_inserter(unique_knots),
       [&] (Knot_ const &lhs_knot, Knot_ const &rhs_knot) { return IsEqual(lhs_knot, rhs_knot, tolerance); });
@@ -173,7 +269,17 @@ void KnotVector::Insert(Knot_ knot, Multiplicity const &multiplicity, Tolerance
     catch (InvalidArgument const &exception) { Throw(exception, kName); }
     catch (OutOfRange const &exception) { Throw(exception, kName); }
 #endif
-  knots_.insert(knots_.begin() + FindSpan(knot, tolerance).Get() + 1, multiplicity.Get(), move(knot));
+  if (!AreBreakpointsDeterminedWith(tolerance)) DetermineBreakpoints(tolerance);
+  int const first_knot{FindSpan(knot, tolerance).Get() + 1}, breakpoint{FindBreakpoint(knot)};
+  if ((breakpoint == static_cast<int>(unique_knots_.size())) || !IsEqual(unique_knots_[breakpoint], knot, tolerance)) {
+    unique_knots_.insert(unique_knots_.begin() + breakpoint, knot);
+    first_knots_.insert(first_knots_.begin() + breakpoint, first_knot);
+  }
+  Multiplicity::Type_ const &multiplicity_value = multiplicity.Get();
+  std::for_each(first_knots_.begin() + breakpoint + 1, first_knots_.end(), [&] (int &current_first_knot) {
+                    current_first_knot += multiplicity_value; });
+  knots_.insert(knots_.begin() + first_knot, multiplicity_value, move(knot));
+  DetectUniformity();
 }
 
 Multiplicity KnotVector::Remove(Knot_ const &knot, Multiplicity const &multiplicity, Tolerance const &tolerance) {
@@ -186,6 +292,7 @@ Multiplicity KnotVector::Remove(Knot_ const &knot, Multiplicity const &multiplic
   } catch (DomainError const &exception) { Throw(exception, kName); }
     catch (InvalidArgument const &exception) { Throw(exception, kName); }
 #endif
+  if (!AreBreakpointsDeterminedWith(tolerance)) DetermineBreakpoints(tolerance);
   if (Multiplicity::Type_ const number_of_removals{std::min(multiplicity,
           DetermineMultiplicity(knot, tolerance)).Get()}; number_of_removals != 0) {
     KnotSpan const &knot_span = FindSpan(knot, tolerance);
@@ -196,6 +303,14 @@ Multiplicity KnotVector::Remove(Knot_ const &knot, Multiplicity const &multiplic
       ConstIterator_ const &first_knot = (knots_.begin() + knot_span.Get());
       knots_.erase(first_knot - (number_of_removals - 1), first_knot + 1);
     }
+    int const breakpoint{FindBreakpoint(knot)};
+    std::for_each(first_knots_.begin() + breakpoint + 1, first_knots_.end(), [&] (int &current_first_knot) {
+                      current_first_knot -= number_of_removals; });
+    if (first_knots_[breakpoint + 1] == first_knots_[breakpoint]) {
+      unique_knots_.erase(unique_knots_.begin() + breakpoint);
+      first_knots_.erase(first_knots_.begin() + breakpoint);
+    }
+    DetectUniformity();
     return Multiplicity{number_of_removals};
   } else {
     return Multiplicity{};
@@ -203,17 +318,114 @@ Multiplicity KnotVector::Remove(Knot_ const &knot, Multiplicity const &multiplic
 }
 
 void KnotVector::IncreaseMultiplicities(Multiplicity const &multiplicity, Tolerance const &tolerance) {
-  for (Knot_ const &knot : GetUniqueKnots(tolerance)) Insert(knot, multiplicity, tolerance);
+#ifndef NDEBUG
+  try {
+    ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) {
+    Throw(exception, "splinelib::sources::parameter_spaces::KnotVector::IncreaseMultiplicities");
+  }
+#endif
+  if (!AreBreakpointsDeterminedWith(tolerance)) DetermineBreakpoints(tolerance);
+  ChangeMultiplicities(multiplicity.Get());
 }
 
 void KnotVector::DecreaseMultiplicities(Multiplicity const &multiplicity, Tolerance const &tolerance) {
-  if (GetSize() > 2) for (Knot_ const &knot : GetUniqueKnots(tolerance)) Remove(knot, multiplicity, tolerance);
+#ifndef NDEBUG
+  try {
+    ThrowIfToleranceIsNegative(tolerance);
+  } catch (InvalidArgument const &exception) {
+    Throw(exception, "splinelib::sources::parameter_spaces::KnotVector::DecreaseMultiplicities");
+  }
+#endif
+  if (GetSize() > 2) {
+    if (!AreBreakpointsDeterminedWith(tolerance)) DetermineBreakpoints(tolerance);
+    ChangeMultiplicities(-multiplicity.Get());
+  }
 }
 
 typename KnotVector::OutputInformation_ KnotVector::Write(Precision const &precision) const {
   return utilities::string_operations::Write<OutputInformation_>(knots_, precision);
 }
 
+bool KnotVector::AreBreakpointsDeterminedWith(Tolerance const &tolerance) const {
+  return (tolerance == breakpoints_tolerance_);
+}
+
+int KnotVector::FindBreakpoint(Knot_ const &knot) const {
+  return std::distance(unique_knots_.begin(), std::lower_bound(unique_knots_.begin(), unique_knots_.end(), knot,
+      [&] (Knot_ const &lhs, Knot_ const &rhs) { return IsLess(lhs, rhs, breakpoints_tolerance_); }));
+}
+
+template<typename Value, typename Projection>
+typename KnotVector::UniformRuns_::const_iterator KnotVector::FindUniformRun(Value const &value,
+                                                                             Projection const &project) const {
+  // The first run is returned for values less than its projection, e.g., parametric coordinates within the tolerance.
+  typename UniformRuns_::const_iterator const &runs_begin = uniform_runs_.begin();
+  if (uniform_runs_.size() == 1) return runs_begin;
+  return std::prev(std::upper_bound(std::next(runs_begin), uniform_runs_.end(), value, [&] (Value const &lhs,
+                                        UniformRun_ const &rhs) { return (lhs < project(std::get<0>(rhs))); }));
+}
+
+void KnotVector::DetermineBreakpoints(Tolerance const &tolerance) {
+  breakpoints_tolerance_ = tolerance;
+  unique_knots_.clear();
+  first_knots_.clear();
+  int const number_of_knots{static_cast<int>(knots_.size())};
+  for (int knot{}; knot < number_of_knots; ++knot) {
+    Knot_ const &current_knot = knots_[knot];
+    if (unique_knots_.empty() || !IsEqual(current_knot, unique_knots_.back(), tolerance)) {
+      unique_knots_.emplace_back(current_knot);
+      first_knots_.emplace_back(knot);
+    }
+  }
+  first_knots_.emplace_back(number_of_knots);
+  DetectUniformity();
+}
+
+void KnotVector::ChangeMultiplicities(int const &change) {
+  Knots_ knots, unique_knots;
+  Vector<int> first_knots{0};
+  int const number_of_unique_knots{static_cast<int>(unique_knots_.size())};
+  knots.reserve(std::max(static_cast<int>(knots_.size()) + number_of_unique_knots * change, 0));
+  for (int breakpoint{}; breakpoint < number_of_unique_knots; ++breakpoint) {
+    int const &first_knot = first_knots_[breakpoint], &multiplicity = (first_knots_[breakpoint + 1] - first_knot),
+              changed_multiplicity{std::max(multiplicity + change, 0)};
+    if (changed_multiplicity == 0) continue;
+    Knot_ const &unique_knot = unique_knots_[breakpoint];
+    ConstIterator_ const &knots_begin = (knots_.begin() + first_knot);
+    knots.insert(knots.end(), knots_begin, knots_begin + std::min(multiplicity, changed_multiplicity));
+    knots.insert(knots.end(), std::max(change, 0), unique_knot);
+    unique_knots.emplace_back(unique_knot);
+    first_knots.emplace_back(first_knots.back() + changed_multiplicity);
+  }
+  knots_ = move(knots);
+  unique_knots_ = move(unique_knots);
+  first_knots_ = move(first_knots);
+  DetectUniformity();
+}
+
+void KnotVector::DetectUniformity() {
+  uniform_runs_.clear();
+  longest_uniform_run_ = 0;
+  int const last_breakpoint{static_cast<int>(unique_knots_.size()) - 1};
+  for (int first_breakpoint{}; first_breakpoint < last_breakpoint;) {
+    // Extends the run as long as the next unique knot is equidistant to the knots of the run, taking the average
+    // distance of the run to avoid accumulating rounding errors.
+    Knot_ const &first_knot = unique_knots_[first_breakpoint];
+    int breakpoint{first_breakpoint + 1};
+    Type_ knot_spacing{(unique_knots_[breakpoint] - first_knot).Get()};
+    for (; breakpoint < last_breakpoint; ++breakpoint) {
+      int const knot_spans{breakpoint + 1 - first_breakpoint};
+      if (!IsEqual(unique_knots_[breakpoint + 1], first_knot + Knot_{knot_spans * knot_spacing},
+                   breakpoints_tolerance_)) break;
+      knot_spacing = ((unique_knots_[breakpoint + 1] - first_knot).Get() / knot_spans);
+    }
+    uniform_runs_.emplace_back(first_breakpoint, breakpoint, knot_spacing);
+    longest_uniform_run_ = std::max(longest_uniform_run_, breakpoint - first_breakpoint);
+    first_breakpoint = breakpoint;
+  }
+}
+
 #ifndef NDEBUG
 void KnotVector::ThrowIfParametricCoordinateIsOutsideScope(ParametricCoordinate const &parametric_coordinate,
                                                            Tolerance const &tolerance) const {
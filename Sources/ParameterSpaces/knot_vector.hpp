@@ -22,7 +22,12 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 
 namespace splinelib::sources::parameter_spaces {
 
-// KnotVectors are sequences of non-decreasing real numbers (called knots).
+// KnotVectors are sequences of non-decreasing real numbers (called knots).  The breakpoints, i.e., the unique knots and
+// their multiplicities, are determined upon construction and kept up to date by all modifications, so that queries
+// using the same tolerance as the last modification do not need to scan the knots.  Moreover, the maximal runs of
+// equidistant unique knots are detected (e.g., a single one for open uniform knot vectors and few ones for uniform knot
+// vectors refined locally), so that FindSpan can compute the knot span arithmetically within the run of the parametric
+// coordinate instead of searching for it.
 //
 // Example:
 //   using Knot = KnotVector::Knot_;
@@ -33,8 +38,11 @@ namespace splinelib::sources::parameter_spaces {
 //   ParametricCoordinate const parametric_coordinate{0.25};
 //   KnotSpan const &knot_span_0_25 = knot_vector.FindSpan(parametric_coordinate),  // Knot span i = 1.
 //                  &knot_span_1_0 = knot_vector.FindSpan(knot);  // The last knot span i = 3 is treated special.
+//   // Knot span i = 2 is found by starting the search from the previous knot span i = 1.
+//   KnotSpan const &knot_span_0_75 = knot_vector.FindSpan(ParametricCoordinate{0.75}, knot_span_0_25);
 //   Multiplicity const &zero = knot_vector.DetermineMultiplicity(parametric_coordinate);  // Multiplicity s = 0.
 //   knot_vector.DoesParametricCoordinateEqualBack(knot);  // Evaluates to true as 1.0 is the last knot.
+//   KnotVector::Type_ const &zero = knot_vector.GetUniformKnotSpacing();  // Unique knots 0.0, 0.5, 0.75, and 1.0.
 class KnotVector {
  public:
   using Knot_ = ParametricCoordinate;
@@ -57,17 +65,33 @@ class KnotVector {
   virtual Knot_ const & operator[](Index const &index) const;
 
   virtual int GetSize() const;
+  // Zero-copy and non-virtual access to all knots, e.g., to load the knots a kernel needs at once.
+  Span<Knot_ const> GetKnots() const;
   virtual Knot_ const & GetFront() const;
   virtual Knot_ const & GetBack() const;
+  // Returns the distance h of consecutive unique knots if the knot vector is uniform and zero otherwise.
+  virtual Type_ GetUniformKnotSpacing() const;
+  // Non-virtual as kernels call it for each knot span: returns the distance h of consecutive unique knots if the knots
+  // u_{i-p+1}, ..., u_{i+p} of the knot span i and the degree p are distinct and equidistant (i.e., the non-zero basis
+  // functions are cardinal B-splines scaled by h) and zero otherwise.
+  Type_ GetUniformKnotSpacing(KnotSpan const &knot_span, int const &degree) const;
 
   virtual bool DoesParametricCoordinateEqualBack(ParametricCoordinate const &parametric_coordinate,
                                                  Tolerance const &tolerance = kEpsilon) const;
   virtual bool DoesParametricCoordinateEqualFrontOrBack(ParametricCoordinate const &parametric_coordinate,
                                                         Tolerance const &tolerance = kEpsilon) const;
   // Returns the (m-s)th or ith knot span if the parametric coordinate u equals the last knot u_m of multiplicity s or
-  // is in the interval [u_i, u_{i+1}) (implying the knot span is non-zero, i.e., u_i < u_{i+1}), respectively.
+  // is in the interval [u_i, u_{i+1}) (implying the knot span is non-zero, i.e., u_i < u_{i+1}), respectively.  Takes
+  // constant time for uniform knot vectors and O(log(r)) for ones consisting of r runs of equidistant unique knots.
   virtual KnotSpan FindSpan(ParametricCoordinate const &parametric_coordinate, Tolerance const &tolerance = kEpsilon)
       const;
+  // Same as above but the search starts from the knot span hint (e.g., the knot span of the previous parametric
+  // coordinate of a monotone sequence) and gallops towards the knot span, i.e., it takes constant time if the
+  // parametric coordinate is in or next to the hinted knot span and O(log(distance)) otherwise.
+  virtual KnotSpan FindSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &knot_span_hint,
+                            Tolerance const &tolerance = kEpsilon) const;
+  // Both take O(log(m)) and O(m) time if the breakpoints have been determined with the same tolerance and O(m)
+  // and O(m) tolerance-based comparisons otherwise, respectively.
   virtual Multiplicity DetermineMultiplicity(Knot_ const &knot, Tolerance const &tolerance = kEpsilon) const;
   virtual Knots_ GetUniqueKnots(Tolerance const &tolerance = kEpsilon) const;
 
@@ -92,10 +116,37 @@ class KnotVector {
 
  private:
   using ConstIterator_ = typename Knots_::const_iterator;
+  using UniformRun_ = Tuple<int, int, Type_>;  // First and last breakpoint as well as distance of the unique knots.
+  using UniformRuns_ = Vector<UniformRun_>;
+
+  // Starts from the knot span hint and gallops towards the knot span (see FindSpan with hint).
+  KnotSpan SearchSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &knot_span_hint,
+                      Tolerance const &tolerance) const;
+  bool AreBreakpointsDeterminedWith(Tolerance const &tolerance) const;
+  // Returns the index of the first unique knot that is not less than the given knot.
+  int FindBreakpoint(Knot_ const &knot) const;
+  void DetermineBreakpoints(Tolerance const &tolerance);
+  // Adds the change to the multiplicities of all unique knots (removing them if their multiplicities drop to zero).
+  void ChangeMultiplicities(int const &change);
+  // Splits the unique knots into maximal runs of equidistant ones (consecutive runs share their boundary breakpoint).
+  void DetectUniformity();
+  // Returns the last run the projection (e.g., the unique knot) of the first breakpoint of which is not greater than
+  // the value (only used by the translation unit).
+  template<typename Value, typename Projection>
+  typename UniformRuns_::const_iterator FindUniformRun(Value const &value, Projection const &project) const;
 
 #ifndef NDEBUG
   void ThrowIfTooSmallOrNotNonDecreasing(Tolerance const &tolerance) const;
 #endif
+
+  // The ith unique knot equals the knots first_knots_[i], ..., first_knots_[i+1]-1 (the last entry of first_knots_ is
+  // the number of knots m+1), i.e., its multiplicity is first_knots_[i+1]-first_knots_[i] and the ith non-zero knot
+  // span is first_knots_[i+1]-1.
+  Tolerance breakpoints_tolerance_{};
+  Knots_ unique_knots_;
+  Vector<int> first_knots_;
+  UniformRuns_ uniform_runs_;
+  int longest_uniform_run_{};  // Number of non-zero knot spans of the longest run.
 };
 
 bool IsEqual(KnotVector const &lhs, KnotVector const &rhs, Tolerance const &tolerance = kEpsilon);
@@ -17,15 +17,19 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #define SOURCES_PARAMETERSPACES_PARAMETER_SPACE_HPP_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <mutex>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 
-#include "Sources/ParameterSpaces/b_spline_basis_function.hpp"
+#include "Sources/ParameterSpaces/b_spline_basis.hpp"
 #include "Sources/ParameterSpaces/knot_vector.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/index.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/math_operations.hpp"
 #include "Sources/Utilities/named_type.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
@@ -68,7 +72,7 @@ class ParameterSpace {
   using StringArray_ = StringArray<parametric_dimensionality>;
 
  protected:
-  using BSplineBasisFunctions_ = BSplineBasisFunctions<parametric_dimensionality>;
+  using BSplineBases_ = BSplineBases<parametric_dimensionality>;
 
  public:
   using BinomialRatios_ = Vector<BinomialRatio>;
@@ -80,25 +84,65 @@ class ParameterSpace {
   using IndexLength_ = typename Index_::Length_;
   using IndexValue_ = typename Index_::Value_;
   using KnotRatios_ = Vector<KnotRatio>;
+  using KnotSpans_ = Array<KnotSpan, parametric_dimensionality>;
   using KnotVectors_ = KnotVectors<parametric_dimensionality>;
   using NumberOfBasisFunctions_ = IndexLength_;
   using NumberOfParametricCoordinates_ = IndexLength_;
   using OutputInformation_ = Tuple<KnotVectorsOutputInformation<parametric_dimensionality>, StringArray_, StringArray_>;
   using ParametricCoordinate_ = Array<ParametricCoordinate, parametric_dimensionality>;
   using ParametricCoordinates_ = Vector<ParametricCoordinate_>;
-  using Type_ = typename BSplineBasisFunctions_::value_type::value_type::element_type::Type_;
+  using Type_ = typename BSplineBases_::value_type::Type_;
   using InsertionCoefficients_ = Vector<KnotRatios_>;
   using InsertionInformation_ = Tuple<Index, InsertionCoefficients_>;
   using Knots_ = typename KnotVectors_::value_type::element_type::Knots_;
+  using RefinementInformation_ = Tuple<KnotVector, Knots_>;
   using BezierInformation_ = Tuple<int, Knots_>;
   using Knot_ = typename Knots_::value_type;
+  using BasisFunctionValues_ = Array<Vector<Type_>, parametric_dimensionality>;
+  using BasisFunctionDerivatives_ = Array<Vector<typename BasisFunctionValues_::value_type>, parametric_dimensionality>;
+  using LaneMajorValues_ = Array<Vector<Type_>, parametric_dimensionality>;
+  using NonZeroBasisFunctions_ = Tuple<Index_, BasisFunctionValues_>;
+  using NonZeroBasisFunctionDerivatives_ = Tuple<Index_, BasisFunctionDerivatives_>;
+  using SampledNonZeroBasisFunctions_ = Array<Vector<Tuple<Index, typename BasisFunctionValues_::value_type>>,
+                                              parametric_dimensionality>;
+  using BezierExtractionOperator_ = Vector<typename BasisFunctionValues_::value_type>;
+  using BezierExtractionOperators_ = Vector<Tuple<Index, BezierExtractionOperator_>>;
+
+  // Reusable storage for the derivatives of the non-zero basis functions (see EvaluateNonZeroBasisFunctionDerivatives
+  // with workspace).  Only the derivatives 0, ..., min(k_d, p_d) are stored along each dimension d as all others are
+  // zero.  They fit into fixed-size arrays for the degrees p_d the kernels are specialized for (see SelectKernel),
+  // i.e., evaluating them does not allocate; otherwise, vectors are only reallocated if their capacities do not
+  // suffice.
+  class DerivativesWorkspace_ {
+   public:
+    Index_ const & GetFirstNonZeroBasisFunction() const;
+    IndexLength_ const & GetNumberOfNonZeroBasisFunctions() const;
+    // Returns the k_d-th derivatives of the p_d+1 non-zero basis functions along dimension d (empty if they are
+    // zero).
+    Span<Type_ const> GetDerivatives(Dimension const &dimension, Derivative const &derivative) const;
+
+    void SetFirstNonZeroBasisFunction(Index_ first_non_zero_basis_function);
+    // Returns the storage of the derivatives 0, ..., k-1 of the p+1 non-zero basis functions along the dimension, i.e.,
+    // the jth non-zero basis function's ith derivative is stored at i*(p+1)+j.
+    Span<Type_> Resize(Dimension const &dimension, int const &number_of_non_zero_basis_functions,
+                       int const &number_of_derivatives);
+
+   private:
+    constexpr static int const kFixedSize_{36};  // (p+1)^2 values, i.e., all non-zero derivatives for p = 5.
+
+    Index_ first_non_zero_basis_function_;
+    IndexLength_ number_of_non_zero_basis_functions_;
+    Array<int, parametric_dimensionality> number_of_derivatives_{};
+    Array<Array<Type_, kFixedSize_>, parametric_dimensionality> fixed_size_derivatives_;
+    Array<Vector<Type_>, parametric_dimensionality> derivatives_;
+  };
 
   ParameterSpace() = default;
   ParameterSpace(KnotVectors_ knot_vectors, Degrees_ degrees, Tolerance const &tolerance = kEpsilon);
   ParameterSpace(ParameterSpace const &other);
-  ParameterSpace(ParameterSpace &&other) noexcept = default;
+  ParameterSpace(ParameterSpace &&other) noexcept;
   ParameterSpace & operator=(ParameterSpace const &rhs);
-  ParameterSpace & operator=(ParameterSpace &&rhs) noexcept = default;
+  ParameterSpace & operator=(ParameterSpace &&rhs) noexcept;
   virtual ~ParameterSpace() = default;
 
   // Comparison based on tolerance.
@@ -111,23 +155,70 @@ class ParameterSpace {
 
   virtual NumberOfBasisFunctions_ GetNumberOfBasisFunctions() const;
   virtual int GetTotalNumberOfBasisFunctions() const;
+  virtual KnotVector GetKnotVector(Dimension const &dimension) const;
 
   virtual Index_ FindFirstNonZeroBasisFunction(ParametricCoordinate_ const &parametric_coordinate,
                                                Tolerance const &tolerance = kEpsilon) const;
   virtual BezierInformation_ DetermineBezierExtractionKnots(Dimension const &dimension,
                                                             Tolerance const &tolerance = kEpsilon) const;
+  // Returns — for each element along the dimension — the first non-zero basis function and the element extraction
+  // operator C^e, i.e., the (p+1)x(p+1) matrix relating the non-zero basis functions to the Bernstein polynomials
+  // (N^e = C^e B), without inserting any knot (see Borden et al. 2011, Alg. 1).
+  virtual BezierExtractionOperators_ DetermineBezierExtractionOperators(Dimension const &dimension,
+                                                                        Tolerance const &tolerance = kEpsilon) const;
 
   virtual Type_ EvaluateBasisFunction(Index_ const &basis_function_index,
       ParametricCoordinate_ const &parametric_coordinate, Tolerance const &tolerance = kEpsilon) const;
   virtual Type_ EvaluateBasisFunctionDerivative(Index_ const &basis_function_index,
       ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
       Tolerance const &tolerance = kEpsilon) const;
+  // Returns the first non-zero basis function and — for each dimension — the values of all p+1 non-zero basis functions
+  // (the knot span is only searched once per dimension), i.e., the factors of the tensor-product basis functions.
+  virtual NonZeroBasisFunctions_ EvaluateNonZeroBasisFunctions(ParametricCoordinate_ const &parametric_coordinate,
+                                                               Tolerance const &tolerance = kEpsilon) const;
+  // Same as above but the knot spans are searched starting from the given knot spans, which are updated afterwards (see
+  // KnotVector::FindSpan with hint), i.e., the knot spans carry over from one parametric coordinate to the next one.
+  virtual NonZeroBasisFunctions_ EvaluateNonZeroBasisFunctions(ParametricCoordinate_ const &parametric_coordinate,
+      KnotSpans_ &knot_spans, Tolerance const &tolerance = kEpsilon) const;
+  // Finds the knot spans of all parametric coordinates, each of which is searched starting from the knot spans of the
+  // previous parametric coordinate (see KnotVector::FindSpan with hint), e.g., to group them by their knot spans.
+  virtual void FindKnotSpans(Span<ParametricCoordinate_ const> parametric_coordinates, Span<KnotSpans_> knot_spans,
+                             Tolerance const &tolerance = kEpsilon) const;
+  // Evaluates the non-zero basis functions of n parametric coordinates, all of which are in the given knot spans, at
+  // once.  Parametric coordinates and values are stored lane by lane (i.e., one lane per parametric coordinate): the
+  // dth component of the lth parametric coordinate is parametric_coordinates[d][l] and the value of the jth non-zero
+  // basis function along dimension d for it is values[d][j*n+l].  Thus, the knots of each knot span are loaded once and
+  // each step of the recurrence is a loop over all lanes, which the compiler can vectorize.  The values are resized
+  // to (p_d+1)*n, i.e., buffers reused for many calls are only reallocated if their capacities do not suffice.
+  virtual void EvaluateNonZeroBasisFunctions(LaneMajorValues_ const &parametric_coordinates,
+      KnotSpans_ const &knot_spans, LaneMajorValues_ &values) const;
+  // Returns the first non-zero basis function and — for each dimension d and each derivative k_d not greater than the
+  // maximum derivative — the k_d-th derivatives of all p_d+1 non-zero basis functions.
+  virtual NonZeroBasisFunctionDerivatives_ EvaluateNonZeroBasisFunctionDerivatives(
+      ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative,
+      Tolerance const &tolerance = kEpsilon) const;
+  // Same as above but with knot span hints (see EvaluateNonZeroBasisFunctions).
+  virtual NonZeroBasisFunctionDerivatives_ EvaluateNonZeroBasisFunctionDerivatives(
+      ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative, KnotSpans_ &knot_spans,
+      Tolerance const &tolerance = kEpsilon) const;
+  // Same as above but evaluates the derivatives into the workspace, i.e., reusing it for many parametric coordinates
+  // does not allocate.
+  virtual void EvaluateNonZeroBasisFunctionDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, DerivativesWorkspace_ &workspace,
+      Tolerance const &tolerance = kEpsilon) const;
 
   virtual InsertionInformation_ InsertKnot(Dimension const &dimension, Knot_ knot,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon);
+  // Inserts all knots at once (the basis functions are recreated only once) and returns the knot vector before the
+  // refinement as well as the sorted knots that have actually been inserted (see NURBS book A5.4).
+  virtual RefinementInformation_ RefineKnots(Dimension const &dimension, Knots_ knots,
+      Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon);
   // Tries to interpret knot removal as the inverse process of knot insertion.
   virtual InsertionInformation_ RemoveKnot(Dimension const &dimension, Knot_ const &knot,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon);
+  // Removes each of the knots once (the basis functions are recreated only once), i.e., equal knots are removed as
+  // often as they are contained in the given knots.
+  virtual void RemoveKnots(Dimension const &dimension, Knots_ const &knots, Tolerance const &tolerance = kEpsilon);
   // Elevation information refer to degree elevation of Bezier basis functions.
   virtual ElevationInformation_ ElevateDegree(Dimension const &dimension,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon);
@@ -135,7 +226,20 @@ class ParameterSpace {
   virtual ElevationInformation_ ReduceDegree(Dimension const &dimension,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon);
 
+  // Records all knot insertions and removals as well as degree elevations and reductions from now on in an undo journal
+  // until the transaction is committed or rolled back (cf. vector_spaces::VectorSpace::BeginTransaction), i.e., undoing
+  // them requires O(number of modifications) instead of a backup of the parameter space.  Transactions can be nested.
+  virtual void BeginTransaction();
+  virtual void CommitTransaction();
+  virtual void RollbackTransaction();
+
   virtual ParametricCoordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates) const;
+  // Returns — for each dimension d and each of the n_d parametric coordinates sampled along it (see Sample) — the first
+  // non-zero basis function and the values of all p_d+1 non-zero basis functions, i.e., the factors of the
+  // tensor-product basis functions for the whole grid.
+  virtual SampledNonZeroBasisFunctions_ SampleNonZeroBasisFunctions(
+      NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
+      Tolerance const &tolerance = kEpsilon) const;
   virtual OutputInformation_ Write(Precision const &precision = kPrecision) const;
 
 #ifndef NDEBUG
@@ -146,20 +250,113 @@ class ParameterSpace {
  protected:
   KnotVectors_ knot_vectors_;
   Degrees_ degrees_;
-  BSplineBasisFunctions_ basis_functions_;
+  mutable BSplineBases_ bases_;
 
  private:
+  using BSplineBasis_ = typename BSplineBases_::value_type;
   using MultiplicityType_ = Multiplicity::Type_;
+  // Kernels write the p+1 values or the derivatives 0, ..., min(k, p) of them (derivative by derivative) into the given
+  // storage (of that size).
+  using NonZeroBasisFunctionsKernel_ = void (*)(KnotVector const &knot_vector, Degree const &degree,
+      KnotSpan const &knot_span, ParametricCoordinate const &parametric_coordinate, Type_ *values);
+  using NonZeroBasisFunctionDerivativesKernel_ = void (*)(KnotVector const &knot_vector, Degree const &degree,
+      KnotSpan const &knot_span, ParametricCoordinate const &parametric_coordinate,
+      Derivative const &maximum_derivative, Type_ *derivatives);
+  using NonZeroBasisFunctionsForLanesKernel_ = void (*)(KnotVector const &knot_vector, Degree const &degree,
+      KnotSpan const &knot_span, Vector<Type_> const &parametric_coordinates, Type_ *values);
+  template<int degree>
+  using CardinalBasisCoefficients_ = Array<Array<Type_, degree + 1>, degree + 1>;
+
+  // Kernels evaluating the non-zero basis functions (and their derivatives) are specialized for the degrees p in
+  // {1, ..., 5} (see SelectKernel); all other degrees are only known at runtime.
+  constexpr static Degree::Type_ const kRuntimeDegree_{-1};
+
+  template<int degree>
+  using KernelKnots_ = std::conditional_t<degree == kRuntimeDegree_, Span<Knot_ const>,
+                                          Array<Knot_, 2 * std::max(degree, 0)>>;
 
   void CopyKnotVectors(KnotVectors_ const &knot_vectors);
-  void RecreateBasisFunctions(Tolerance const &tolerance = kEpsilon);
+  void CopyBasisFunctions(ParameterSpace const &other);
+  void MoveBasisFunctions(ParameterSpace &&other) noexcept;
+  // Copies the kernels, tolerances, and flags belonging to the basis functions.
+  void CopyBasisFunctionsState(ParameterSpace const &other) noexcept;
+  // Selects the (specialized) kernels evaluating the non-zero basis functions of the dimension right away but only
+  // marks its basis functions as outdated, so that modifying a dimension repeatedly recreates them at most once (see
+  // GetBasisFunctions).
+  void InvalidateBasisFunctions(Dimension const &dimension, Tolerance const &tolerance = kEpsilon);
+  // Recreates the basis functions of the dimension if they are outdated.  Thread-safe, i.e., concurrent (const)
+  // evaluations recreate them only once.
+  BSplineBasis_ const & GetBasisFunctions(Dimension const &dimension) const;
 
   // Number of non-zero basis functions is equal to p+1 - see NURBS book P2.2.
   int GetNumberOfNonZeroBasisFunctions(Dimension const &dimension) const;
   NumberOfBasisFunctions_ GetNumberOfNonZeroBasisFunctions() const;
   // Number of basis functions n is equal to m-(p+1) - see NURBS book P2.8.
   Length GetNumberOfBasisFunctions(Dimension const &dimension) const;
+  // Returns the parametric coordinate with the given index out of all ones sampled uniformly along the dimension.
+  ParametricCoordinate SampleParametricCoordinate(Dimension const &dimension, int const &parametric_coordinate,
+                                                  Length const &number_of_parametric_coordinates) const;
+  // Evaluates the non-zero basis functions in the knot spans returned by find_knot_span(dimension, parametric
+  // coordinate) for each dimension.
+  template<typename KnotSpanFinder>
+  NonZeroBasisFunctions_ EvaluateNonZeroBasisFunctionsInKnotSpans(ParametricCoordinate_ const &parametric_coordinate,
+                                                                  KnotSpanFinder const &find_knot_span) const;
+  template<typename KnotSpanFinder>
+  void EvaluateNonZeroBasisFunctionDerivativesInKnotSpans(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, KnotSpanFinder const &find_knot_span,
+      DerivativesWorkspace_ &workspace) const;
+  // Copies the derivatives 0, ..., k_d (including the ones of order k_d > p_d) out of the workspace.
+  static NonZeroBasisFunctionDerivatives_ CopyNonZeroBasisFunctionDerivatives(DerivativesWorkspace_ const &workspace,
+      Derivative_ const &maximum_derivative);
+  // Cf. NURBS book A2.2.
+  typename BasisFunctionValues_::value_type EvaluateNonZeroBasisFunctions(Dimension const &dimension,
+      KnotSpan const &knot_span, ParametricCoordinate const &parametric_coordinate) const;
+  // If the degree is known at compile time (i.e., it is not kRuntimeDegree_), the knots u_{i-p+1}, ..., u_{i+p} and
+  // all temporaries are fixed-size arrays and all loops have constant trip counts, so that the compiler can unroll them
+  // completely.  Moreover, the cardinal basis coefficients are used within uniform knot spans (see
+  // ComputeCardinalBasisCoefficients).
+  template<int degree>
+  static void EvaluateNonZeroBasisFunctions(KnotVector const &knot_vector, Degree const &runtime_degree,
+      KnotSpan const &knot_span, ParametricCoordinate const &parametric_coordinate, Type_ *values);
+  // Same as above but for all lanes at once (see EvaluateNonZeroBasisFunctions for lanes).
+  template<int degree>
+  static void EvaluateNonZeroBasisFunctionsForLanes(KnotVector const &knot_vector, Degree const &runtime_degree,
+      KnotSpan const &knot_span, Vector<Type_> const &parametric_coordinates, Type_ *values);
+  // Returns select_kernel(std::integral_constant<int, p>{}) for the degrees p specialized for and
+  // select_kernel(std::integral_constant<int, kRuntimeDegree_>{}) otherwise.
+  template<typename KernelSelector>
+  static auto SelectKernel(Degree const &degree, KernelSelector const &select_kernel);
+  // Loads the knots u_{i-p+1}, ..., u_{i+p} the non-zero basis functions of knot span i depend on at once (see
+  // KnotVector::GetKnots).
+  template<int degree>
+  static KernelKnots_<degree> LoadKnots(KnotVector const &knot_vector, Degree::Type_ const &degree_value,
+                                        KnotSpan const &knot_span);
+  // Within knot spans [u_i, u_{i+1}) enclosed by p equidistant knots on either side (of distance h), the non-zero basis
+  // functions are translates of the cardinal B-spline of degree p and thus equal the polynomials
+  // N_{i-p+k}(u) = sum_{j=0}^p c_{kj} t^j in t = (u-u_i)/h, the coefficients c_{kj} of which only depend on p.
+  template<int degree>
+  constexpr static CardinalBasisCoefficients_<degree> ComputeCardinalBasisCoefficients();
+  // Cf. NURBS book A2.3.
+  void EvaluateNonZeroBasisFunctionDerivatives(Dimension const &dimension, KnotSpan const &knot_span,
+      ParametricCoordinate const &parametric_coordinate, Derivative const &maximum_derivative,
+      DerivativesWorkspace_ &workspace) const;
+  // Specialized like the kernels evaluating the non-zero basis functions (except for the cardinal basis coefficients).
+  template<int degree>
+  static void EvaluateNonZeroBasisFunctionDerivatives(KnotVector const &knot_vector, Degree const &runtime_degree,
+      KnotSpan const &knot_span, ParametricCoordinate const &parametric_coordinate,
+      Derivative const &maximum_derivative, Type_ *derivatives);
+
+  enum class Modification_ { kInsertion, kRemoval, kElevation, kReduction };
+  // Modification, dimension, knot (only for insertions and removals), multiplicity, and tolerance.
+  using JournalEntry_ = Tuple<Modification_, Dimension, Knot_, Multiplicity, Tolerance>;
 
+  // Records the modification only if a transaction has been begun.
+  void Record(Modification_ const &modification, Dimension const &dimension, Knot_ knot,
+              Multiplicity const &multiplicity, Tolerance const &tolerance);
+  // Removes the knot from the knot vector and records the knot as it has been stored (not only equal to the given one
+  // within the tolerance), so that rolling back the removal restores the knot vector exactly.
+  Multiplicity RemoveAndRecord(Dimension const &dimension, Knot_ const &knot, Multiplicity const &multiplicity,
+                               Tolerance const &tolerance);
   InsertionInformation_ DetermineInsertionInformation(Dimension const &dimension, ParametricCoordinate const &knot,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const;
   ElevationInformation_ DetermineElevationInformation(Dimension const &dimension,
@@ -169,7 +366,18 @@ class ParameterSpace {
   void ThrowIfBasisFunctionIndexIsInvalid(Index_ const &basis_function_index) const;
   void ThrowIfFrontOrBackKnotIsToBeInsertedOrRemoved(Dimension const &dimension, ParametricCoordinate const &knot,
                                                      Tolerance const &tolerance) const;
+  void ThrowIfNoTransactionHasBeenBegun() const;
 #endif
+
+  Array<NonZeroBasisFunctionsKernel_, parametric_dimensionality> non_zero_basis_functions_kernels_{};
+  Array<NonZeroBasisFunctionDerivativesKernel_, parametric_dimensionality>
+      non_zero_basis_function_derivatives_kernels_{};
+  Array<NonZeroBasisFunctionsForLanesKernel_, parametric_dimensionality> non_zero_basis_functions_for_lanes_kernels_{};
+  mutable Array<std::atomic<bool>, parametric_dimensionality> are_basis_functions_outdated_{};
+  Array<Tolerance, parametric_dimensionality> basis_functions_tolerances_{};
+  mutable std::mutex basis_functions_mutex_;
+  Vector<JournalEntry_> journal_;
+  Vector<int> transactions_;  // Sizes of the journal when the (nested) transactions were begun.
 };
 
 #include "Sources/ParameterSpaces/parameter_space.inc"
@@ -17,20 +17,26 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #define SOURCES_SPLINES_B_SPLINE_HPP_
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <utility>
 
 #include "Sources/Splines/spline.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/index.hpp"
+#include "Sources/Utilities/math_operations.hpp"
 #include "Sources/Utilities/named_type.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
+#include "Sources/Utilities/system_operations.hpp"
 #include "Sources/VectorSpaces/vector_space.hpp"
 
 namespace splinelib::sources::splines {
 
 template<int parametric_dimensionality, int dimensionality> class BSpline;
+template<int parametric_dimensionality, int dimensionality> class Nurbs;
 
 template<int parametric_dimensionality, int dimensionality>
 bool IsEqual(BSpline<parametric_dimensionality, dimensionality> const &lhs,
@@ -51,11 +57,16 @@ class BSpline : public Spline<parametric_dimensionality, dimensionality> {
  public:
   using Base_ = Spline<parametric_dimensionality, dimensionality>;
   using Coordinate_ = typename Base_::Coordinate_;
+  using Coordinates_ = typename Base_::Coordinates_;
   using Derivative_ = typename Base_::Derivative_;
+  using EvaluationContext_ = typename Base_::EvaluationContext_;
   using Knot_ = typename Base_::Knot_;
+  using Knots_ = typename Base_::Knots_;
+  using NumberOfParametricCoordinates_ = typename Base_::NumberOfParametricCoordinates_;
   using ParameterSpace_ = typename Base_::ParameterSpace_;
   using ParametricCoordinate_ = typename Base_::ParametricCoordinate_;
   using VectorSpace_ = typename Base_::VectorSpace_;
+  using DerivativesWorkspace_ = typename ParameterSpace_::DerivativesWorkspace_;
   using OutputInformation_ = Tuple<typename ParameterSpace_::OutputInformation_,
                                    typename VectorSpace_::OutputInformation_>;
 
@@ -74,14 +85,40 @@ class BSpline : public Spline<parametric_dimensionality, dimensionality> {
   friend bool operator==<parametric_dimensionality, dimensionality>(BSpline const &lhs, BSpline const &rhs);
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Tolerance const &tolerance = kEpsilon)
       const override;
+  Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &evaluation_context,
+                         Tolerance const &tolerance = kEpsilon) const override;
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
                          Tolerance const &tolerance = kEpsilon) const override;
+  Coordinates_ EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance const &tolerance = kEpsilon) const override;
+  // Same as above but evaluates the derivatives of the non-zero basis functions into the workspace and stores the
+  // derivatives in the given ones (resized to their number), i.e., reusing both for many parametric coordinates does
+  // not allocate.
+  void EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative,
+      DerivativesWorkspace_ &workspace, Coordinates_ &derivatives, Tolerance const &tolerance = kEpsilon) const;
+  // Groups the parametric coordinates by their knot spans, so that the non-zero basis functions are evaluated for many
+  // parametric coordinates at once and the associated control points are gathered once per group (see
+  // EvaluateGroupedByKnotSpans).
+  void Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                Tolerance const &tolerance = kEpsilon) const override;
 
   void InsertKnot(Dimension const &dimension, Knot_ knot, Multiplicity const &multiplicity = kMultiplicity,
                   Tolerance const &tolerance = kEpsilon) const override;
+  // Inserts all knots at once and computes the new control points in a single pass for all hyperplane slices along the
+  // dimension (see NURBS book A5.4).
+  void RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity = kMultiplicity,
+                   Tolerance const &tolerance = kEpsilon) const override;
   // Tries to interpret knot removal as the inverse process of knot insertion.
   Multiplicity RemoveKnot(Dimension const &dimension, Knot_ const &knot, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const override;
+  // Bounds the error of removing each interior knot once, greedily removes the knot with the smallest bound as long as
+  // the bounds accumulated within its support do not exceed the removal tolerance, and updates the bounds of the
+  // neighboring knots only (see NURBS book A9.8 and A5.8).  The control points are copied, modified, and replaced, and
+  // the basis functions are recreated only once.
+  Knots_ RemoveKnots(Dimension const &dimension, Tolerance const &tolerance_removal,
+                     Tolerance const &tolerance = kEpsilon) const override;
+  // Elevates the degree segment by segment without Bezier decomposition of the whole B-spline (see NURBS book A5.9),
+  // i.e., the elevated control points are computed into a preallocated buffer that replaces the control points once.
   void ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity = kMultiplicity,
                      Tolerance const &tolerance = kEpsilon) const override;
   // Tries to interpret degree reduction as the inverse process of degree elevation.
@@ -89,23 +126,86 @@ class BSpline : public Spline<parametric_dimensionality, dimensionality> {
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const override;
 
   Coordinate ComputeUpperBoundForMaximumDistanceFromOrigin(Tolerance const &tolerance = kEpsilon) const override;
+  // Contracts the control points dimension by dimension with the basis functions sampled along each dimension (sum
+  // factorization) instead of evaluating the B-spline at every parametric coordinate of the grid.
+  Coordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon)
+      const override;
+  // Returns the Bezier control points of all elements along the dimension without modifying the B-spline (see
+  // ParameterSpace::DetermineBezierExtractionOperators).  The elements are stored one after another, each of them
+  // consisting of p_d+1 control points along the dimension and all control points along the other dimensions.
+  Coordinates_ ExtractBezierElements(Dimension const &dimension,
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon) const;
+  // Same as above but for the tensor-product elements, i.e., each element consists of (p_0+1)x...x(p_{n-1}+1) control
+  // points.
+  Coordinates_ ExtractBezierElements(NumberOfThreads const &number_of_threads = kNumberOfThreads,
+                                     Tolerance const &tolerance = kEpsilon) const;
   OutputInformation_ Write(Precision const &precision = kPrecision) const;
 
  protected:
   SharedPointer<VectorSpace_> vector_space_;
 
  private:
+  friend class Nurbs<parametric_dimensionality, dimensionality - 1>;
+
+  using BezierExtractionOperator_ = typename ParameterSpace_::BezierExtractionOperator_;
+  using BezierExtractionOperators_ = typename ParameterSpace_::BezierExtractionOperators_;
   using BezierInformation_ = typename ParameterSpace_::BezierInformation_;
   using BinomialRatios_ = typename ParameterSpace_::BinomialRatios_;
   using Index_ = typename Base_::Index_;
   using IndexLength_ = typename Index_::Length_;
   using IndexValue_ = typename Index_::Value_;
   using KnotRatios_ = typename ParameterSpace_::KnotRatios_;
-  using Knots_ = typename Base_::Knots_;
+  using KnotSpans_ = typename ParameterSpace_::KnotSpans_;
+  using LaneMajorValues_ = typename ParameterSpace_::LaneMajorValues_;
+  using NonZeroBasisFunctions_ = typename ParameterSpace_::NonZeroBasisFunctions_;
+  using SampledNonZeroBasisFunctions_ = typename ParameterSpace_::SampledNonZeroBasisFunctions_;
+  using Type_ = typename ParameterSpace_::Type_;
   using BinomialRatio_ = typename BinomialRatios_::value_type;
+  using Components_ = Array<Type_, dimensionality>;
   using KnotRatio_ = typename KnotRatios_::value_type;
-
+  using ProjectedCoordinate_ = Array<Coordinate, dimensionality - 1>;
+
+  constexpr static int const kMaximumNumberOfLanes_{64};  // Parametric coordinates evaluated at once.
+
+  // Contracts the control points with the given non-zero basis functions.
+  Coordinate_ Contract(NonZeroBasisFunctions_ const &non_zero_basis_functions) const;
+  // Same as above but without allocations: walks the non-zero basis functions (dimension 0 varies fastest) and updates
+  // the offsets of the associated control points only along the dimensions that changed.  The components are gathered
+  // from the storage directly depending on the layout (see vector_spaces::Layout).
+  Components_ ContractComponents(NonZeroBasisFunctions_ const &non_zero_basis_functions) const;
+  // Returns true if the control points associated with the non-zero basis functions are in complete blocks (see
+  // vector_spaces::Layout::kBlocked and VectorSpace::DetermineArrangedOffset).
+  bool AreControlPointsArranged(Index_ const &first_non_zero_basis_function,
+                                IndexLength_ const &number_of_non_zero_basis_functions) const;
+  // Determines the offsets of the control points associated with the non-zero basis functions (dimension 0 varies
+  // fastest) relative to the first one.  If true is returned, the control points are arranged (see
+  // AreControlPointsArranged) and the offsets are positions for VectorSpace::GetStoredCoordinate instead.
+  bool DetermineControlPointOffsets(Index_ const &first_non_zero_basis_function,
+      IndexLength_ const &number_of_non_zero_basis_functions, Vector<int> &control_point_offsets) const;
+  // Sorts the parametric coordinates by their knot spans and evaluates the non-zero basis functions of up to
+  // kMaximumNumberOfLanes_ parametric coordinates sharing the same knot spans at once (see
+  // ParameterSpace::EvaluateNonZeroBasisFunctions for lane-major values).  The control points are gathered once per
+  // group and accumulated over all lanes in tight loops.  Calls store(coordinate, components) for each of them.
+  template<typename ComponentsStorer>
+  void EvaluateGroupedByKnotSpans(Span<ParametricCoordinate_ const> parametric_coordinates,
+                                  ComponentsStorer const &store, Tolerance const &tolerance) const;
+  // Interprets the last component of each control point as its weight (see vector_spaces::WeightedVectorSpace) and
+  // projects the weighted sum in the same pass, i.e., evaluates the corresponding NURBS (cf. NURBS book Eq. (4.5)).
+  // Only the NURBS owning this B-spline as its homogeneous B-spline is meant to use it.
+  ProjectedCoordinate_ EvaluateProjected(ParametricCoordinate_ const &parametric_coordinate,
+                                         EvaluationContext_ &evaluation_context, Tolerance const &tolerance) const;
+  void EvaluateProjected(Span<ParametricCoordinate_ const> parametric_coordinates,
+                         Span<ProjectedCoordinate_> projected_coordinates, Tolerance const &tolerance) const;
+  // Contracts the control points with the given derivatives of the non-zero basis functions.
+  Coordinate_ Contract(DerivativesWorkspace_ const &workspace, Derivative_ const &derivative) const;
+  // Arranges the control points in blocks again (see vector_spaces::Layout::kBlocked) after their number has changed.
+  void ArrangeControlPoints() const;
   BezierInformation_ MakeBezier(Dimension const &dimension, Tolerance const &tolerance = kEpsilon) const;
+  // Dimensions without Bezier extraction operators are not extracted, i.e., they consist of a single element.
+  Coordinates_ ExtractBezierElements(
+      Array<BezierExtractionOperators_, parametric_dimensionality> const &bezier_extraction_operators,
+      NumberOfThreads const &number_of_threads) const;
 };
 
 #include "Sources/Splines/b_spline.inc"
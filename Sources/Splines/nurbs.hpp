@@ -17,7 +17,6 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #define SOURCES_SPLINES_NURBS_HPP_
 
 #include <algorithm>
-#include <deque>
 #include <iterator>
 #include <utility>
 
@@ -54,11 +53,19 @@ class Nurbs : public Spline<parametric_dimensionality, dimensionality> {
  public:
   using Base_ = Spline<parametric_dimensionality, dimensionality>;
   using Coordinate_ = typename Base_::Coordinate_;
+  using Coordinates_ = typename Base_::Coordinates_;
   using Derivative_ = typename Base_::Derivative_;
+  using EvaluationContext_ = typename Base_::EvaluationContext_;
   using Knot_ = typename Base_::Knot_;
+  using Knots_ = typename Base_::Knots_;
+  using NumberOfParametricCoordinates_ = typename Base_::NumberOfParametricCoordinates_;
   using ParameterSpace_ = typename Base_::ParameterSpace_;
   using ParametricCoordinate_ = typename Base_::ParametricCoordinate_;
   using WeightedVectorSpace_ = vector_spaces::WeightedVectorSpace<dimensionality>;
+  // Derivatives of the non-zero basis functions and of the homogeneous B-spline (see EvaluateDerivatives with
+  // workspace).
+  using DerivativesWorkspace_ = Tuple<typename ParameterSpace_::DerivativesWorkspace_,
+                                      Vector<Array<Coordinate, dimensionality + 1>>>;
   using OutputInformation_ = Tuple<typename ParameterSpace_::OutputInformation_,
                                    typename WeightedVectorSpace_::OutputInformation_>;
 
@@ -75,21 +82,40 @@ class Nurbs : public Spline<parametric_dimensionality, dimensionality> {
                                                                  Tolerance const &tolerance);
   // Comparison based on numeric_operations::GetEpsilon<Tolerance>().
   friend bool operator==<parametric_dimensionality, dimensionality>(Nurbs const &lhs, Nurbs const &rhs);
+  // Accumulates the weighted control points and projects the sum in a single pass (see BSpline::EvaluateProjected).
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate,
                          Tolerance const &tolerance = kEpsilon) const final;
+  Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &evaluation_context,
+                         Tolerance const &tolerance = kEpsilon) const final;
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
                          Tolerance const &tolerance = kEpsilon) const final;
+  Coordinates_ EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance const &tolerance = kEpsilon) const final;
+  // Same as above but evaluates the derivatives of the non-zero basis functions and of the homogeneous B-spline into
+  // the workspace and stores the derivatives in the given ones (resized to their number), i.e., reusing both for many
+  // parametric coordinates does not allocate.
+  void EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative,
+      DerivativesWorkspace_ &workspace, Coordinates_ &rational_derivatives, Tolerance const &tolerance = kEpsilon)
+      const;
+  void Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                Tolerance const &tolerance = kEpsilon) const final;
 
   void InsertKnot(Dimension const &dimension, Knot_ knot, Multiplicity const &multiplicity = kMultiplicity,
                   Tolerance const &tolerance = kEpsilon) const final;
+  void RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity = kMultiplicity,
+                   Tolerance const &tolerance = kEpsilon) const final;
   Multiplicity RemoveKnot(Dimension const &dimension, Knot_ const &knot, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const final;
+  Knots_ RemoveKnots(Dimension const &dimension, Tolerance const &tolerance_removal,
+                     Tolerance const &tolerance = kEpsilon) const final;
   void ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity = kMultiplicity,
                      Tolerance const &tolerance = kEpsilon) const final;
   bool ReduceDegree(Dimension const &dimension, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const final;
 
   Coordinate ComputeUpperBoundForMaximumDistanceFromOrigin(Tolerance const &tolerance = kEpsilon) const final;
+  Coordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon) const final;
   OutputInformation_ Write(Precision const &precision = kPrecision) const;
 
  protected:
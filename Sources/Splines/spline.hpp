@@ -25,6 +25,7 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/Utilities/named_type.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
+#include "Sources/Utilities/system_operations.hpp"
 #include "Sources/VectorSpaces/vector_space.hpp"
 
 namespace splinelib::sources::splines {
@@ -59,6 +60,9 @@ class Spline : public SplineItem {
   using Knots_ = typename ParameterSpace_::Knots_;
   using NumberOfParametricCoordinates_ = typename ParameterSpace_::NumberOfParametricCoordinates_;
   using ParametricCoordinate_ = typename ParameterSpace_::ParametricCoordinate_;
+  using ParametricCoordinates_ = typename ParameterSpace_::ParametricCoordinates_;
+  // Knot spans of the previous evaluation, which are used as hints by the next one (each thread needs its own context).
+  using EvaluationContext_ = typename ParameterSpace_::KnotSpans_;
 
   ~Spline() override = default;
 
@@ -69,25 +73,42 @@ class Spline : public SplineItem {
   friend bool operator==<parametric_dimensionality, dimensionality>(Spline const &lhs, Spline const &rhs);
   virtual Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate,
                                  Tolerance const &tolerance = kEpsilon) const = 0;
+  // Same as above but carries the knot spans over to the next evaluation, which makes evaluating monotone sequences of
+  // parametric coordinates (e.g., along curves) cheaper; the default implementation ignores the context.
+  virtual Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate,
+      EvaluationContext_ &evaluation_context, Tolerance const &tolerance = kEpsilon) const;
   virtual Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
                                  Tolerance const &tolerance = kEpsilon) const = 0;
+  // Returns all derivatives not greater than the maximum derivative (ordered as the corresponding utilities::Index).
+  virtual Coordinates_ EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance const &tolerance = kEpsilon) const;
+  // Evaluates the spline at all parametric coordinates and stores the results in the (equally many) coordinates.
+  virtual void Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                        Tolerance const &tolerance = kEpsilon) const;
 
   virtual void InsertKnot(Dimension const &dimension, Knot_ knot, Multiplicity const &multiplicity = kMultiplicity,
                           Tolerance const &tolerance = kEpsilon) const = 0;
-  void RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity = kMultiplicity,
-                   Tolerance const &tolerance = kEpsilon) const;
+  // Inserts the knots one by one.
+  virtual void RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity = kMultiplicity,
+                           Tolerance const &tolerance = kEpsilon) const;
   virtual Multiplicity RemoveKnot(Dimension const &dimension, Knot_ const &knot, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const = 0;
+  // Removes the knots one by one.
   Multiplicity CoarsenKnots(Dimension const &dimension, Knots_ const &knots, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const;
+  // Removes as many interior knots as possible (data reduction) without having to name them, such that the sum of the
+  // removal errors stays within the removal tolerance, and returns the removed knots.
+  virtual Knots_ RemoveKnots(Dimension const &dimension, Tolerance const &tolerance_removal,
+                             Tolerance const &tolerance = kEpsilon) const = 0;
   virtual void ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity = kMultiplicity,
                              Tolerance const &tolerance = kEpsilon) const = 0;
   virtual bool ReduceDegree(Dimension const &dimension, Tolerance const &tolerance_reduction,
       Multiplicity const &multiplicity = kMultiplicity, Tolerance const &tolerance = kEpsilon) const = 0;
 
   virtual Coordinate ComputeUpperBoundForMaximumDistanceFromOrigin(Tolerance const &tolerance = kEpsilon) const = 0;
+  // Samples the spline on a uniform grid; the coordinates are (deterministically) divided among the threads.
   virtual Coordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
-                              Tolerance const &tolerance = kEpsilon) const;
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon) const;
 
  protected:
   using Index_ = typename ParameterSpace_::Index_;
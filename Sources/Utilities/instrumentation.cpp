@@ -0,0 +1,155 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "Sources/Utilities/instrumentation.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+
+namespace splinelib::sources::utilities::instrumentation {
+
+namespace {
+
+using Values = Array<Value, kNumberOfCounters + 2 * kNumberOfPhases>;
+
+// Keeps track of the values of all running threads and accumulates the values of the threads that have exited.
+class Registry {
+ public:
+  void Register(ThreadValues &thread_values);
+  void Unregister(ThreadValues &thread_values);
+  Values Sum();
+  void Reset();
+
+ private:
+  std::mutex mutex_;
+  Vector<ThreadValues *> thread_values_;
+  Values values_of_exited_threads_{};
+};
+
+Registry & GetRegistry();
+
+// Registers the values of the thread on construction and retains them on destruction (when the thread exits).
+class RegisteredThreadValues {
+ public:
+  RegisteredThreadValues();
+  RegisteredThreadValues(RegisteredThreadValues const &other) = delete;
+  RegisteredThreadValues(RegisteredThreadValues &&other) noexcept = delete;
+  RegisteredThreadValues & operator=(RegisteredThreadValues const &rhs) = delete;
+  RegisteredThreadValues & operator=(RegisteredThreadValues &&rhs) noexcept = delete;
+  ~RegisteredThreadValues();
+
+  ThreadValues values_{};
+};
+
+constexpr Array<char const *, kNumberOfCounters> const kCounterNames{"basis function evaluations", "span searches",
+    "basis function recreations", "vector space insertions", "vector space erasures", "vector space copies",
+    "bytes allocated"};
+constexpr Array<char const *, kNumberOfPhases> const kPhaseNames{"read", "parse", "sample", "write"};
+
+}  // namespace
+
+ThreadValues & RegisterThreadValues() {
+  thread_local RegisteredThreadValues registered_thread_values;
+  return *(thread_values = &registered_thread_values.values_);
+}
+
+Statistics GetSnapshot() {
+  Values const &values = GetRegistry().Sum();
+  Statistics statistics;
+  auto &[counts, timings] = statistics;
+  std::copy_n(values.begin(), kNumberOfCounters, counts.begin());
+  for (int phase{}; phase < kNumberOfPhases; ++phase) {
+    int const &value = (kNumberOfCounters + 2 * phase);
+    timings[phase] = {values[value], Duration{values[value + 1]}};
+  }
+  return statistics;
+}
+
+void Reset() {
+  GetRegistry().Reset();
+}
+
+String Write(Statistics const &statistics) {
+  using std::get;
+
+  auto const &[counts, timings] = statistics;
+  std::ostringstream written;
+  for (int counter{}; counter < kNumberOfCounters; ++counter)
+      written << kCounterNames[counter] << ": " << counts[counter] << "\n";
+  for (int phase{}; phase < kNumberOfPhases; ++phase)
+      written << kPhaseNames[phase] << ": " << get<0>(timings[phase]) << " ("
+              << std::chrono::duration<double>(get<1>(timings[phase])).count() << " s)\n";
+  return written.str();
+}
+
+ScopedTimer::ScopedTimer(Phase const &phase) : phase_(phase), start_(Clock_::now()) {}
+
+ScopedTimer::~ScopedTimer() {
+  Value const &duration = std::chrono::duration_cast<Duration>(Clock_::now() - start_).count();
+  ThreadValues &thread_values = GetThreadValues();
+  int const &value = (kNumberOfCounters + 2 * static_cast<int>(phase_));
+  std::atomic<Value> &number_of_timings = thread_values[value], &total_duration = thread_values[value + 1];
+  number_of_timings.store(number_of_timings.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  total_duration.store(total_duration.load(std::memory_order_relaxed) + duration, std::memory_order_relaxed);
+}
+
+namespace {
+
+void Registry::Register(ThreadValues &thread_values) {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  thread_values_.push_back(&thread_values);
+}
+
+void Registry::Unregister(ThreadValues &thread_values) {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  for (int value{}; value < static_cast<int>(values_of_exited_threads_.size()); ++value)
+      values_of_exited_threads_[value] += thread_values[value].load(std::memory_order_relaxed);
+  thread_values_.erase(std::find(thread_values_.begin(), thread_values_.end(), &thread_values));
+}
+
+Values Registry::Sum() {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  Values sum{values_of_exited_threads_};
+  for (ThreadValues const * const thread_values : thread_values_)
+      for (int value{}; value < static_cast<int>(sum.size()); ++value)
+          sum[value] += (*thread_values)[value].load(std::memory_order_relaxed);
+  return sum;
+}
+
+void Registry::Reset() {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  values_of_exited_threads_.fill(0);
+  for (ThreadValues * const thread_values : thread_values_)
+      for (std::atomic<Value> &value : *thread_values) value.store(0, std::memory_order_relaxed);
+}
+
+// The registry is never destroyed as threads may still exit during the destruction of static objects.
+Registry & GetRegistry() {
+  static Registry * const registry{new Registry};
+  return *registry;
+}
+
+RegisteredThreadValues::RegisteredThreadValues() {
+  GetRegistry().Register(values_);
+}
+
+RegisteredThreadValues::~RegisteredThreadValues() {
+  GetRegistry().Unregister(values_);
+}
+
+}  // namespace
+
+}  // namespace splinelib::sources::utilities::instrumentation
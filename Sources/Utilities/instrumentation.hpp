@@ -0,0 +1,112 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef SOURCES_UTILITIES_INSTRUMENTATION_HPP_
+#define SOURCES_UTILITIES_INSTRUMENTATION_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "Sources/Utilities/std_container_operations.hpp"
+#include "Sources/Utilities/string_operations.hpp"
+
+// Instrumentation of hot paths by counters and timers of scoped phases.  Instrumented code is only compiled if
+// SPLINELIB_INSTRUMENTATION is defined (see CMake option INSTRUMENTATION), so calls of Count and the construction of
+// ScopedTimers are guarded by "#ifdef SPLINELIB_INSTRUMENTATION".  Each thread increments its own counters without
+// synchronization; snapshots sum up the counters of all threads including those that have already exited.  Phases can
+// be nested (e.g., reading a file includes parsing its splines).
+//
+// Example:
+//   Count(Counter::kSpanSearches);
+//   { ScopedTimer const timer{Phase::kWrite}; ... }
+//   Statistics const &statistics = GetSnapshot();
+//   String const &report = Write(statistics);  // "span searches: 1\n...write: 1 (0.001 s)\n".
+namespace splinelib::sources::utilities::instrumentation {
+
+enum class Counter { kBasisFunctionEvaluations, kSpanSearches, kBasisFunctionRecreations, kVectorSpaceInsertions,
+                     kVectorSpaceErasures, kVectorSpaceCopies, kBytesAllocated };
+enum class Phase { kRead, kParse, kSample, kWrite };
+using Value = std::int64_t;
+using Duration = std::chrono::nanoseconds;
+
+constexpr int const kNumberOfCounters{7}, kNumberOfPhases{4};
+#ifdef SPLINELIB_INSTRUMENTATION
+constexpr bool const kIsEnabled{true};
+#else
+constexpr bool const kIsEnabled{false};
+#endif
+
+using Counts = Array<Value, kNumberOfCounters>;
+using Timings = Array<Tuple<Value, Duration>, kNumberOfPhases>;  // Number of timings and total duration of each phase.
+using Statistics = Tuple<Counts, Timings>;
+// Values of a thread: counters followed by the number of timings and the total duration (in ns) of each phase.
+using ThreadValues = Array<std::atomic<Value>, kNumberOfCounters + 2 * kNumberOfPhases>;
+
+// Only relaxed loads and stores of the calling thread's own values are required as no other thread writes them.
+void Count(Counter const &counter, Value const &increment = 1);
+// Inline access to the values of the calling thread cached in thread_values; only the first call of each thread
+// registers its values out of line.
+ThreadValues & GetThreadValues();
+ThreadValues & RegisterThreadValues();
+inline thread_local ThreadValues *thread_values{};
+
+Statistics GetSnapshot();
+// Must not be called concurrently with instrumented code.
+void Reset();
+String Write(Statistics const &statistics);
+
+// Adds the time from its construction to its destruction to the phase.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Phase const &phase);
+  ScopedTimer(ScopedTimer const &other) = delete;
+  ScopedTimer(ScopedTimer &&other) noexcept = delete;
+  ScopedTimer & operator=(ScopedTimer const &rhs) = delete;
+  ScopedTimer & operator=(ScopedTimer &&rhs) noexcept = delete;
+  ~ScopedTimer();
+
+ private:
+  using Clock_ = std::chrono::steady_clock;
+
+  Phase phase_;
+  Clock_::time_point start_;
+};
+
+// Base of classes the copies of which are counted by the counter (e.g., vector spaces), so that they can keep their
+// defaulted copy constructors and assignment operators.  As bases are copied before members, the befriended hook
+// Counted::CountAllocatedBytesOfCopy(target) can count the bytes the copy of the members into the target (nullptr for
+// copy constructions) will allocate.  Empty and trivial unless SPLINELIB_INSTRUMENTATION is defined.
+template<typename Counted, Counter counter>
+class CopyCounter {
+ public:
+  CopyCounter() = default;
+#ifdef SPLINELIB_INSTRUMENTATION
+  CopyCounter(CopyCounter const &other);
+  CopyCounter & operator=(CopyCounter const &rhs);
+#else
+  CopyCounter(CopyCounter const &other) = default;
+  CopyCounter & operator=(CopyCounter const &rhs) = default;
+#endif
+  CopyCounter(CopyCounter &&other) noexcept = default;
+  CopyCounter & operator=(CopyCounter &&rhs) noexcept = default;
+  ~CopyCounter() = default;
+};
+
+#include "Sources/Utilities/instrumentation.inc"
+
+}  // namespace splinelib::sources::utilities::instrumentation
+
+#endif  // SOURCES_UTILITIES_INSTRUMENTATION_HPP_
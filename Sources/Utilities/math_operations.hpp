@@ -16,13 +16,28 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #ifndef SOURCES_UTILITIES_MATH_OPERATIONS_HPP_
 #define SOURCES_UTILITIES_MATH_OPERATIONS_HPP_
 
+#include <array>
+
 // Math operations (that are not implemented by the standard library) such as 1.) computing binomial coefficients.
+// Binomial coefficients of sets with up to kMaximumNumberOfElementsInSet elements, i.e., all binomial coefficients
+// that can be represented by int, are tabulated at compile time (Pascal's triangle) and looked up by
+// GetBinomialCoefficient, which falls back to ComputeBinomialCoefficient otherwise.
 //
 // Example:
 //   int const &four_choose_2 = ComputeBinomialCoefficient(4, 2);  // The binomial coefficient "4 choose 2" equals 6.
+//   constexpr int const kFourChoose2{GetBinomialCoefficient(4, 2)};  // Looked up at compile time.
 namespace splinelib::sources::utilities::math_operations {
 
+constexpr int const kMaximumNumberOfElementsInSet{33};
+
+using BinomialCoefficients = std::array<std::array<int, kMaximumNumberOfElementsInSet + 1>,
+                                        kMaximumNumberOfElementsInSet + 1>;
+
 int ComputeBinomialCoefficient(int const &number_of_elements_in_set, int const &number_of_elements_in_subset);
+constexpr BinomialCoefficients TabulateBinomialCoefficients();
+constexpr int GetBinomialCoefficient(int const &number_of_elements_in_set, int const &number_of_elements_in_subset);
+
+#include "Sources/Utilities/math_operations.inc"
 
 }  // namespace splinelib::sources::utilities::math_operations
 
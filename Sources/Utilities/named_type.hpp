@@ -159,6 +159,7 @@ namespace splinelib {
 using Dimension = sources::utilities::NamedType<struct DimensionName, int>;
 using Index = sources::utilities::NamedType<struct IndexName, int>;
 using Length = sources::utilities::NamedType<struct LengthName, int>;
+using NumberOfThreads = sources::utilities::NamedType<struct NumberOfThreadsName, int>;
 using Precision = sources::utilities::NamedType<struct PrecisionName, int>;
 
 // parameter spaces
@@ -202,6 +203,7 @@ using Type = vector_spaces::Type;
 using Tolerance = Type;
 
 constexpr Multiplicity const kMultiplicity{parameter_spaces::kMultiplicity};
+constexpr NumberOfThreads const kNumberOfThreads{1};
 constexpr Precision const kPrecision{utilities::numeric_operations::GetPrecision<Type>()};
 constexpr Tolerance const kEpsilon{utilities::numeric_operations::GetEpsilon<Tolerance>()};
 
@@ -213,6 +215,7 @@ namespace sources::input_output {
 using Type = splines::Type;
 using Tolerance = Type;
 
+constexpr NumberOfThreads const kNumberOfThreads{1};
 constexpr Precision const kPrecision{utilities::numeric_operations::GetPrecision<Type>()};
 constexpr Tolerance const kEpsilon{utilities::numeric_operations::GetEpsilon<Tolerance>()};
 
@@ -22,7 +22,9 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <numeric>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -38,6 +40,8 @@ template<typename Type, size_t size>
 using Array = std::array<Type, size>;
 template<typename Type>
 using SharedPointer = std::shared_ptr<Type>;
+template<typename Type>
+using Span = std::span<Type>;
 template<typename ...Types>
 using Tuple = std::tuple<Types...>;
 template<typename Type>
@@ -47,8 +51,8 @@ using Vector = std::vector<Type>;
 
 // STD container operations such as 1.) checking container types at compile time (currently std::array and std::vector),
 // 2.) checked and unchecked (i.e., faster) access to containers in debug and release mode, respectively, 3.)
-// transforming containers storing NamedTypes, 4.) generalized comparisons of contained/pointed at values, and 5.) basic
-// arithmetic operations.
+// transforming containers storing NamedTypes, 4.) generalized comparisons of contained/pointed at values, 5.) basic
+// arithmetic operations, and 6.) aligned allocation.
 //
 // Example:
 //   using NamedInts = Vector<NamedInt>;
@@ -130,6 +134,24 @@ constexpr typename ContainerType::value_type TwoNorm(ContainerType const &contai
 template<typename ContainerType>
 constexpr typename ContainerType::value_type EuclidianDistance(ContainerType const &lhs, ContainerType const &rhs);
 
+// Allocates storage aligned to the given number of bytes, e.g., to cache lines for vectorized access of std::vectors.
+template<typename Type, size_t alignment>
+struct AlignedAllocator {
+  using value_type = Type;
+  template<typename OtherType>
+  struct rebind { using other = AlignedAllocator<OtherType, alignment>; };
+
+  AlignedAllocator() = default;
+  template<typename OtherType>
+  constexpr AlignedAllocator(AlignedAllocator<OtherType, alignment> const &other) noexcept;
+
+  template<typename OtherType>
+  constexpr bool operator==(AlignedAllocator<OtherType, alignment> const &rhs) const noexcept;
+
+  Type * allocate(size_t number_of_values);
+  void deallocate(Type *values, size_t number_of_values) noexcept;
+};
+
 #ifndef NDEBUG
 template<typename ContainerTypeLhs, typename ContainerTypeRhs>
 void ThrowIfContainerSizesDiffer(ContainerTypeLhs const &lhs, ContainerTypeRhs const &rhs);
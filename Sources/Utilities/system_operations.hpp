@@ -16,18 +16,24 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #ifndef SOURCES_UTILITIES_SYSTEM_OPERATIONS_HPP_
 #define SOURCES_UTILITIES_SYSTEM_OPERATIONS_HPP_
 
+#include <algorithm>
 #include <ctime>
+#include <exception>
 #include <fstream>
 #include <ios>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/named_type.hpp"
 
-// System operations such as 1.) getting the local time and 2.) opening files.
+// System operations such as 1.) getting the local time, 2.) opening files, and 3.) distributing work among threads.
 //
 // Example:
 //   LocalTime const &local_time = GetLocalTime();
 //   OutputStream output_stream{Open<OutputStream, kModeOut>("file.out")};
+//   ForEachBlockInParallel(0, 100, NumberOfThreads{4}, [&] (int const &first, int const &behind) { ... });
 namespace splinelib::sources::utilities::system_operations {
 
 using File = std::string;
@@ -44,6 +50,14 @@ LocalTime GetLocalTime();
 template<typename FileStream, Mode mode>
 FileStream Open(File const &file);
 
+// Splits [first, behind) into (at most) number_of_threads contiguous blocks of similar size and calls function(first,
+// behind) for each block on its own thread (the first block is processed by the calling thread).  As every block is
+// known in advance, results written to disjoint positions do not depend on the number of threads.  After all threads
+// have been joined, the exception of the first failing block (if any) is rethrown.
+template<typename Function>
+void ForEachBlockInParallel(int const &first, int const &behind, NumberOfThreads const &number_of_threads,
+                            Function const &function);
+
 #include "Sources/Utilities/system_operations.inc"
 
 }  // namespace splinelib::sources::utilities::system_operations
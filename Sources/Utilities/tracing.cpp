@@ -0,0 +1,158 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "Sources/Utilities/tracing.hpp"
+
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include "Sources/Utilities/std_container_operations.hpp"
+#include "Sources/Utilities/system_operations.hpp"
+
+namespace splinelib::sources::utilities::tracing {
+
+namespace {
+
+// Name, detail, thread, start, and duration of a span.
+using Event = Tuple<char const *, String, int, Clock::time_point, Clock::duration>;
+
+// Keeps the spans that have been recorded since tracing was started.
+class Recorder {
+ public:
+  void Start();
+  void Record(Event event);
+  String Write();
+
+ private:
+  std::mutex mutex_;
+  Vector<Event> events_;
+  Clock::time_point start_;
+};
+
+Recorder & GetRecorder();
+// Threads are numbered in the order of their first recorded span (the thread starting tracing first) as the ids of
+// std::thread cannot be written.
+int GetThread();
+void WriteEscaped(std::ostringstream &written, char const * const string);
+
+}  // namespace
+
+void Start() {
+  GetRecorder().Start();
+  GetThread();
+  GetIsRecording().store(true, std::memory_order_relaxed);
+}
+
+void Stop() {
+  GetIsRecording().store(false, std::memory_order_relaxed);
+}
+
+std::atomic<bool> & GetIsRecording() {
+  static std::atomic<bool> is_recording{false};
+  return is_recording;
+}
+
+String Write() {
+  return GetRecorder().Write();
+}
+
+void Write(String const &file_name) {
+  using system_operations::OutputStream;
+
+  OutputStream file{system_operations::Open<OutputStream, system_operations::kModeOut>(file_name)};
+  file << Write();
+}
+
+void ScopedSpan::Record() const {
+  Clock::duration const &duration = (Clock::now() - start_);
+  String detail{(detail_ != nullptr) ? detail_ : ""};
+  if (index_ != kNoIndex) {
+    if (!detail.empty()) detail += ' ';
+    detail += std::to_string(index_);
+  }
+  GetRecorder().Record({name_, std::move(detail), GetThread(), start_, duration});
+}
+
+namespace {
+
+void Recorder::Start() {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  events_.clear();
+  start_ = Clock::now();
+}
+
+void Recorder::Record(Event event) {
+  std::lock_guard<std::mutex> const lock{mutex_};
+  events_.emplace_back(std::move(event));
+}
+
+// Writes complete events ("ph":"X") with timestamps and durations in µs relative to the start of tracing.
+String Recorder::Write() {
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  using std::get;
+
+  std::lock_guard<std::mutex> const lock{mutex_};
+  std::ostringstream written;
+  written << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool is_first{true};
+  for (Event const &event : events_) {
+    written << (is_first ? "" : ",") << "\n{\"name\":\"";
+    WriteEscaped(written, get<0>(event));
+    written << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << get<2>(event) << ",\"ts\":"
+            << Microseconds(get<3>(event) - start_).count() << ",\"dur\":" << Microseconds(get<4>(event)).count();
+    String const &detail = get<1>(event);
+    if (!detail.empty()) {
+      written << ",\"args\":{\"detail\":\"";
+      WriteEscaped(written, detail.c_str());
+      written << "\"}";
+    }
+    written << "}";
+    is_first = false;
+  }
+  written << "\n]}\n";
+  return written.str();
+}
+
+// Deliberately leaked: spans may end while static objects are destroyed and must not record into a destroyed recorder.
+Recorder & GetRecorder() {
+  static Recorder * const recorder{new Recorder};
+  return *recorder;
+}
+
+int GetThread() {
+  static std::atomic<int> number_of_threads{};
+  thread_local int const thread{number_of_threads.fetch_add(1, std::memory_order_relaxed)};
+  return thread;
+}
+
+void WriteEscaped(std::ostringstream &written, char const * const string) {
+  for (char const *character{string}; *character != '\0'; ++character) {
+    if ((*character == '"') || (*character == '\\')) {
+      written << '\\' << *character;
+    } else if (static_cast<unsigned char>(*character) < 0x20) {
+      char escaped[7];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*character));
+      written << escaped;
+    } else {
+      written << *character;
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace splinelib::sources::utilities::tracing
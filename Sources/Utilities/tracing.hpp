@@ -0,0 +1,76 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#ifndef SOURCES_UTILITIES_TRACING_HPP_
+#define SOURCES_UTILITIES_TRACING_HPP_
+
+#include <atomic>
+#include <chrono>
+
+#include "Sources/Utilities/string_operations.hpp"
+
+// Tracing of nested spans (e.g., reading a file or sampling a spline) into a timeline that can be written as Chrome
+// trace event file (JSON) and inspected with chrome://tracing or Perfetto.  In contrast to instrumentation, tracing is
+// always compiled but only records spans between Start and Stop, so that spans shall only be placed around coarse
+// operations.  Spans are recorded together with the thread they ran on, which shows the parallel utilization.
+//
+// Example:
+//   Start();
+//   { ScopedSpan const span{"vtk::Sample", "spline", 0}; ... }
+//   Stop();
+//   Write("trace.json");  // {"traceEvents":[{"name":"vtk::Sample","ph":"X",...,"args":{"detail":"spline 0"}}]}.
+namespace splinelib::sources::utilities::tracing {
+
+using Clock = std::chrono::steady_clock;
+
+// Name of the environment variable the tools read the file name of the trace from.
+constexpr char const * const kFileNameVariable{"SPLINELIB_TRACE"};
+
+// Discards all spans recorded so far.
+void Start();
+void Stop();
+bool IsRecording();
+std::atomic<bool> & GetIsRecording();
+String Write();
+void Write(String const &file_name);
+
+// Records the span from its construction to its destruction if tracing was recording on its construction.  Spans that
+// are not recorded neither read the clock nor build their details, which are only composed of the detail and (unless
+// kNoIndex) the index (e.g., "spline 0") when recorded, so the detail has to outlive the span.
+class ScopedSpan {
+ public:
+  constexpr static int const kNoIndex{-1};
+
+  explicit ScopedSpan(char const * const name, char const * const detail = nullptr, int const &index = kNoIndex);
+  ScopedSpan(ScopedSpan const &other) = delete;
+  ScopedSpan(ScopedSpan &&other) noexcept = delete;
+  ScopedSpan & operator=(ScopedSpan const &rhs) = delete;
+  ScopedSpan & operator=(ScopedSpan &&rhs) noexcept = delete;
+  ~ScopedSpan();
+
+ private:
+  void Record() const;
+
+  char const *name_, *detail_;
+  int index_;
+  bool is_recorded_;
+  Clock::time_point start_{};
+};
+
+#include "Sources/Utilities/tracing.inc"
+
+}  // namespace splinelib::sources::utilities::tracing
+
+#endif  // SOURCES_UTILITIES_TRACING_HPP_
@@ -18,9 +18,11 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 
 #include <algorithm>
 #include <functional>
+#include <numeric>
 #include <utility>
 
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/named_type.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
@@ -30,6 +32,14 @@ namespace splinelib::sources::vector_spaces {
 
 template<int dimensionality> class VectorSpace;
 
+// Coordinates are always stored as array of structures (AoS).  Layout::kStructureOfArrays additionally stores each
+// component of all coordinates contiguously (SoA) and keeps these arrays up to date on each modification, i.e., single
+// coordinates are replaced, inserted, or erased in place.  Layout::kBlocked stores the coordinates of a net (see
+// VectorSpace::Arrange) block by block instead of row by row, i.e., the (up to) kBlockLength^n coordinates of each
+// block of the n-dimensional net are stored contiguously, so that the (p_0+1)x...x(p_{n-1}+1) coordinates gathered by
+// an evaluation are spread over a few blocks instead of (p_1+1)x...x(p_{n-1}+1) rows.
+enum class Layout { kArrayOfStructures, kStructureOfArrays, kBlocked };
+
 template<int dimensionality>
 bool IsEqual(VectorSpace<dimensionality> const &lhs, VectorSpace<dimensionality> const &rhs,
              Tolerance const &tolerance = kEpsilon);
@@ -48,14 +58,19 @@ bool operator==(VectorSpace<dimensionality> const &lhs, VectorSpace<dimensionali
 //   Coordinate const &coordinate = vector_space[Index{1}];  // Coordinate P_1 = {1.0, 0.0, 0.0}.
 //   ScalarCoordinate const &one_point_zero = vector_space.DetermineMaximumDistanceFromOrigin();
 template<int dimensionality>
-class VectorSpace {
+class VectorSpace : private utilities::instrumentation::CopyCounter<VectorSpace<dimensionality>,
+                        utilities::instrumentation::Counter::kVectorSpaceCopies> {
  public:
+  using Component_ = Span<Coordinate::Type_ const>;
   using Coordinate_ = Array<Coordinate, dimensionality>;
   using Coordinates_ = Vector<Coordinate_>;
   using OutputInformation_ = Tuple<Vector<StringArray<dimensionality>>>;
 
+  constexpr static int const kBlockLength{4};  // Number of coordinates along each dimension of the blocks.
+  constexpr static int const kComponentAlignment{64};  // Alignment of the components of Layout::kStructureOfArrays.
+
   VectorSpace() = default;
-  explicit VectorSpace(Coordinates_ coordinates);
+  explicit VectorSpace(Coordinates_ coordinates, Layout const &layout = Layout::kArrayOfStructures);
   VectorSpace(VectorSpace const &other) = default;
   VectorSpace(VectorSpace &&other) noexcept = default;
   VectorSpace & operator=(VectorSpace const &rhs) = default;
@@ -69,19 +84,98 @@ class VectorSpace {
   virtual Coordinate_ const & operator[](Index const &coordinate) const;
 
   virtual int GetNumberOfCoordinates() const;
+  Layout const & GetLayout() const;
+  // Zero-copy access to the values of the component of all coordinates for Layout::kStructureOfArrays.  They are stored
+  // contiguously, aligned to kComponentAlignment bytes, and padded with zeros (at least) up to the next multiple of it.
+  Component_ GetComponent(Dimension const &component) const;
   virtual void Replace(Index const &coordinate_index, Coordinate_ coordinate);
+  // Replaces all coordinates at once, e.g., after the whole control net has been restructured.
+  virtual void Replace(Coordinates_ coordinates);
   virtual void Insert(Index const &coordinate_index, Coordinate_ coordinate);
   virtual void Erase(Index const &coordinate_index);
+  // Arranges the coordinates — interpreted as a net with the given numbers of coordinates along each dimension — in
+  // blocks for Layout::kBlocked and does nothing for other layouts.  Coordinates are still accessed by their indices
+  // in the net (cf. utilities::Index::GetIndex1d).  Inserting, erasing, or replacing all coordinates stores them row by
+  // row again until they are arranged anew, whereas Restructure keeps them arranged.
+  template<size_t parametric_dimensionality>
+  void Arrange(Array<Length, parametric_dimensionality> const &number_of_coordinates);
+  bool IsArranged() const;
+  // The position of an arranged coordinate within the storage is the sum of the offsets of its indices along each
+  // dimension if all blocks it is contained in are complete, i.e., contain kBlockLength coordinates along the
+  // dimension.  Zero-copy access to the stored coordinates at these positions bypasses the virtual operator[].
+  bool IsInCompleteBlock(Dimension const &dimension, int const &index) const;
+  int DetermineArrangedOffset(Dimension const &dimension, int const &index) const;
+  Coordinate_ const & GetStoredCoordinate(int const &position) const;
+  // Restructures the coordinates — interpreted as a net with the given numbers of coordinates along each dimension —
+  // along the dimension at once instead of inserting or erasing coordinates one by one, i.e., in O(number of
+  // coordinates) with a single allocation: produce_line(line, restructured_line) is called for each line of coordinates
+  // along the dimension and fills the restructured line, whose length is given by the restructured numbers of
+  // coordinates.  Implemented in terms of operator[], Replace(Coordinates_), and Arrange.
+  template<size_t parametric_dimensionality, typename LineProducer>
+  void Restructure(Dimension const &dimension, Array<Length, parametric_dimensionality> const &number_of_coordinates,
+                   Array<Length, parametric_dimensionality> const &restructured_number_of_coordinates,
+                   LineProducer const &produce_line);
+  // Records all modifications from now on in an undo journal until the transaction is committed or rolled back, i.e.,
+  // undoing them requires O(number of modifications) instead of a backup of all coordinates.  Transactions can be
+  // nested.
+  virtual void BeginTransaction();
+  virtual void CommitTransaction();
+  virtual void RollbackTransaction();
 
   virtual Coordinate DetermineMaximumDistanceFromOrigin(Tolerance const &tolerance = kEpsilon) const;
   virtual OutputInformation_ Write(Precision const &precision = kPrecision) const;
 
  protected:
-  Coordinates_ coordinates_;
+  Coordinates_ coordinates_;  // Stored depending on the layout.
+
+  // Non-virtual access to the coordinates by their indices regardless of the layout.
+  Coordinate_ const & GetCoordinate(Index const &coordinate) const;
 
  private:
+  using CopyCounter_ = utilities::instrumentation::CopyCounter<VectorSpace,
+                                                               utilities::instrumentation::Counter::kVectorSpaceCopies>;
+
+  friend CopyCounter_;
+
+  enum class Modification_ { kErasure, kInsertion, kReplacement, kReplacementOfAll };
+  using Components_ = std::vector<Coordinate::Type_, utilities::std_container_operations::AlignedAllocator<
+                                                         Coordinate::Type_, kComponentAlignment>>;
+  using JournalEntry_ = Tuple<Modification_, Index, Coordinate_>;
+  using NetDimension_ = Tuple<int, int>;
+
+  Layout layout_{Layout::kArrayOfStructures};
+  Components_ components_;  // Padded components of all coordinates one after another for Layout::kStructureOfArrays.
+  int component_stride_{};
+  // Numbers of coordinates and strides along each dimension of the net arranged in blocks (empty if stored row by row).
+  Vector<NetDimension_> net_;
+  Vector<JournalEntry_> journal_;
+  Vector<Coordinates_> replaced_coordinates_;
+  Vector<int> transactions_;  // Sizes of the journal when the (nested) transactions were begun.
+
+  // Only update the components for Layout::kStructureOfArrays: all of them (padded to at least the given stride) or
+  // those of a single coordinate.
+  void UpdateComponents(int const &minimum_component_stride = 0);
+  void UpdateComponents(Index const &coordinate_index);
+  // Only update the components for Layout::kStructureOfArrays after a coordinate has been inserted or erased.
+  void InsertComponents(Index const &coordinate_index);
+  void EraseComponents(Index const &coordinate_index);
+  // Position of the coordinate within coordinates_.
+  int DetermineStorageIndex(Index const &coordinate) const;
+  // Stores the coordinates row by row again if they have been arranged in blocks.
+  void StoreRowByRow();
+  // Records the modification only if a transaction has been begun.
+  void Record(Modification_ const &modification, Index const &coordinate_index, Coordinate_ coordinate = {});
+#ifdef SPLINELIB_INSTRUMENTATION
+  // Counts the bytes of the storage of the coordinates and components exceeding the previous capacities.
+  void CountAllocatedBytes(size_t const &previous_coordinates_capacity, size_t const &previous_components_capacity)
+      const;
+  // Counts the bytes copying the coordinates and components into the target (nullptr if constructed) will allocate.
+  void CountAllocatedBytesOfCopy(VectorSpace const *target) const;
+#endif
 #ifndef NDEBUG
   void ThrowIfIndexIsInvalid(Index const &coordinate) const;
+  void ThrowIfNumberOfCoordinatesDiffers(int const &expected_number_of_coordinates) const;
+  void ThrowIfNoTransactionHasBeenBegun() const;
 #endif
 };
 
@@ -63,7 +63,10 @@ class WeightedVectorSpace : public VectorSpace<dimensionality + 1> {
   using Weights_ = Vector<Weight>;
 
   WeightedVectorSpace() = default;
-  WeightedVectorSpace(Coordinates_ const &coordinates, Weights_ const &weights);
+  // For Layout::kStructureOfArrays, the components are the ones of the homogeneous coordinates, i.e., the last one
+  // stores the weights.
+  WeightedVectorSpace(Coordinates_ const &coordinates, Weights_ const &weights,
+                      Layout const &layout = Layout::kArrayOfStructures);
   WeightedVectorSpace(WeightedVectorSpace const &other) = default;
   WeightedVectorSpace(WeightedVectorSpace &&other) noexcept = default;
   WeightedVectorSpace & operator=(WeightedVectorSpace const &rhs) = default;
@@ -13,6 +13,8 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <cstdio>
+
 #include <gtest/gtest.h>
 #include "Sources/InputOutput/operations.hpp"
 #include "Sources/Utilities/error_handling.hpp"
@@ -42,6 +44,18 @@ TEST(OperationsSuite, Read) {
   EXPECT_NO_THROW(Read(xml_file));
 }
 
+TEST(OperationsSuite, Write) {
+  String const kFilename{"operations_test.itd"};
+
+  Splines splines_read;
+  ASSERT_NO_THROW(splines_read = Read(irit_file));
+  EXPECT_NO_THROW(Write(splines_read, kFilename));
+  Splines splines_written;
+  ASSERT_NO_THROW(splines_written = Read(kFilename));
+  EXPECT_EQ(splines_written.size(), splines_read.size());
+  std::remove(kFilename.c_str());
+}
+
 TEST(OperationsSuite, CastToSpline) {
   SplineEntry const b_spline_entry{std::make_shared<splines::A2d3dBSplineMock>()};
 
@@ -61,6 +75,8 @@ TEST(OperationsSuite, ThrowIfFileFormatNotSupported) {
   EXPECT_THROW(Read("test"), RuntimeError);
   EXPECT_THROW(Read("test.vtk"), RuntimeError);
   EXPECT_THROW(Read("test.invalid"), RuntimeError);
+  EXPECT_THROW(Write({}, "test"), RuntimeError);
+  EXPECT_THROW(Write({}, "test.vtk"), RuntimeError);
 }
 #endif
 }  // namespace splinelib::tests::input_output::operations
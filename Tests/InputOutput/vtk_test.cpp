@@ -13,10 +13,13 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include "Sources/InputOutput/vtk.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
+#include "Sources/Utilities/system_operations.hpp"
 #include "Tests/Splines/b_spline_mock.hpp"
 
 namespace splinelib::tests::input_output {
@@ -45,6 +48,22 @@ TEST_F(VtkSuite, Write) {
   remove(kFilename_.c_str());
 }
 
+TEST_F(VtkSuite, WriteInParallel) {
+  using sources::utilities::system_operations::InputStream, sources::utilities::system_operations::kModeIn,
+        sources::utilities::system_operations::Open;
+
+  auto const &read = [] () {
+      std::ostringstream content;
+      content << Open<InputStream, kModeIn>(kFilename_).rdbuf();
+      return content.str(); };
+  ASSERT_NO_THROW(Sample({b_spline_, b_spline_, b_spline_}, kFilename_, {{k3_, k3_}, {k3_, k3_}, {k3_, k3_}}));
+  sources::utilities::string_operations::String const &serial = read();
+  ASSERT_NO_THROW(Sample({b_spline_, b_spline_, b_spline_}, kFilename_, {{k3_, k3_}, {k3_, k3_}, {k3_, k3_}},
+                         NumberOfThreads{4}));
+  EXPECT_EQ(read(), serial);
+  remove(kFilename_.c_str());
+}
+
 #ifndef NDEBUG
 TEST_F(VtkSuite, ThrowIfNumbersOfParametricCoordinatesIsInvalid) {
   EXPECT_THROW(Sample({b_spline_}, kFilename_, {}), RuntimeError);
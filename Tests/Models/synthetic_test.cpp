@@ -0,0 +1,76 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Sources/Models/rectangular.hpp"
+#include "Sources/Models/synthetic.hpp"
+#include "Sources/Utilities/named_type.hpp"
+
+namespace splinelib::tests::models {
+
+using namespace sources::models::synthetic;  // NOLINT(build/namespaces)
+
+class SyntheticSuite : public testing::Test {
+ protected:
+  using BSpline_ = sources::splines::BSpline<2, 3>;
+  using Coordinate_ = BSpline_::Coordinate_;
+  using Nurbs_ = sources::splines::Nurbs<2, 3>;
+  using ParametricCoordinate_ = BSpline_::ParametricCoordinate_;
+
+  constexpr static Degree const kDegreeOne_{1}, kDegreeThree_{3};
+  constexpr static Length const kLengthOne_{1}, kLengthTwo_{2}, kLengthFour_{4};
+  constexpr static Multiplicity const kMultiplicityOne_{1}, kMultiplicityTwo_{2};
+  constexpr static ParametricCoordinate const kParametricCoordinate0_{0.0}, kParametricCoordinate1_{1.0},
+                                              kParametricCoordinate0_3_{0.3}, kParametricCoordinate0_7_{0.7};
+  constexpr static Coordinate const kCoordinate0_{0.0}, kCoordinate0_7_{0.7}, kCoordinate1_{1.0},
+                                    kCoordinate1_3_{1.3}, kCoordinate2_{2.0};
+};
+
+TEST_F(SyntheticSuite, GeneratePatch) {
+  using sources::models::rectangular::Generate;
+
+  EXPECT_EQ((GeneratePatch<2, 3, false>({kLengthTwo_, kLengthOne_}, {kDegreeOne_, kDegreeOne_},
+                {kMultiplicityOne_, kMultiplicityOne_}, KnotDistribution::kUniform)),
+            (Generate<2, 3, false>({kLengthTwo_, kLengthOne_}, {kDegreeOne_, kDegreeOne_})));
+  for (KnotDistribution const &knot_distribution :
+           {KnotDistribution::kUniform, KnotDistribution::kGraded, KnotDistribution::kRandom}) {
+    BSpline_ const &b_spline = GeneratePatch<2, 3, false>({kLengthFour_, kLengthTwo_}, {kDegreeThree_, kDegreeOne_},
+        {kMultiplicityTwo_, kMultiplicityOne_}, knot_distribution, {Index{1}, Index{}});
+    EXPECT_EQ(b_spline(ParametricCoordinate_{kParametricCoordinate0_3_, kParametricCoordinate0_7_}),
+              (Coordinate_{kCoordinate1_3_, kCoordinate0_7_, kCoordinate0_}));
+  }
+  EXPECT_EQ((GeneratePatch<2, 3, true>({kLengthFour_, kLengthTwo_}, {kDegreeThree_, kDegreeOne_},
+                {kMultiplicityOne_, kMultiplicityOne_}, KnotDistribution::kRandom)),
+            (GeneratePatch<2, 3, true>({kLengthFour_, kLengthTwo_}, {kDegreeThree_, kDegreeOne_},
+                {kMultiplicityOne_, kMultiplicityOne_}, KnotDistribution::kRandom)));
+  EXPECT_FALSE((GeneratePatch<2, 3, true>({kLengthFour_, kLengthTwo_}, {kDegreeThree_, kDegreeOne_},
+                    {kMultiplicityOne_, kMultiplicityOne_}, KnotDistribution::kRandom)) ==
+               (GeneratePatch<2, 3, true>({kLengthFour_, kLengthTwo_}, {kDegreeThree_, kDegreeOne_},
+                    {kMultiplicityOne_, kMultiplicityOne_}, KnotDistribution::kRandom, {}, Seed{1})));
+}
+
+TEST_F(SyntheticSuite, GenerateModel) {
+  Splines const &nurbs = GenerateModel<2, 3, true>({kLengthTwo_, kLengthTwo_}, {kLengthFour_, kLengthFour_},
+      {kDegreeThree_, kDegreeThree_}, {kMultiplicityTwo_, kMultiplicityOne_}, KnotDistribution::kGraded);
+  ASSERT_EQ(nurbs.size(), 4);
+  SharedPointer<Nurbs_> const &last_patch = std::dynamic_pointer_cast<Nurbs_>(nurbs.back());
+  ASSERT_TRUE(last_patch);
+  EXPECT_EQ((*last_patch)(ParametricCoordinate_{kParametricCoordinate0_, kParametricCoordinate1_}),
+            (Coordinate_{kCoordinate1_, kCoordinate2_, kCoordinate0_}));
+}
+
+}  // namespace splinelib::tests::models
@@ -114,21 +114,6 @@ class ABSplineBasisFunctionMock : public virtual sources::parameter_spaces::BSpl
   constexpr static Tolerance_ const kEpsilon_ = sources::parameter_spaces::kEpsilon;
 };
 
-namespace mock_b_spline_basis_functions {
-
-using BSplineBasisFunctions = sources::parameter_spaces::BSplineBasisFunctions<2>;
-
-BSplineBasisFunctions Empty();
-BSplineBasisFunctions NurbsBookExa2_2();
-BSplineBasisFunctions NurbsBookExa2_2ElevatedOnce();
-BSplineBasisFunctions NurbsBookExa2_2Inserted();
-BSplineBasisFunctions NurbsBookExa2_2Subdivided();
-BSplineBasisFunctions NurbsBookExe3_8();
-BSplineBasisFunctions NurbsBookExe3_8InsertRemove();
-BSplineBasisFunctions NurbsBookExe4_4();
-
-}  // namespace mock_b_spline_basis_functions
-
 }  // namespace splinelib::tests::parameter_spaces
 
 #endif  // TESTS_PARAMETERSPACES_B_SPLINE_BASIS_FUNCTION_MOCK_HPP_
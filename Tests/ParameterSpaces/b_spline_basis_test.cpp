@@ -0,0 +1,113 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <gtest/gtest.h>
+#include "Sources/ParameterSpaces/b_spline_basis.hpp"
+#include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/numeric_operations.hpp"
+#include "Tests/ParameterSpaces/knot_vector_mock.hpp"
+
+namespace splinelib::tests::parameter_spaces {
+
+using sources::parameter_spaces::BSplineBasis;
+using sources::utilities::numeric_operations::IsEqual;
+
+// Test basis of degree 2 from NURBS book Exa. 2.1.
+class BSplineBasisSuite : public testing::Test {
+ protected:
+  using KnotVector_ = testing::StrictMock<AKnotVectorMock>;
+  using Tolerance_ = sources::parameter_spaces::Tolerance;
+  using Type_ = BSplineBasis::Type_;
+
+  constexpr static Degree const kDegree2_{2};
+  constexpr static KnotSpan const kKnotSpan0_{}, kKnotSpan2_{2};
+  constexpr static Tolerance_ const &kEpsilon_ = sources::parameter_spaces::kEpsilon;
+  constexpr static Tolerance_ const kTolerance_{1.2 * kEpsilon_}, kToleranceDegree_{kDegree2_.Get() * kTolerance_};
+  constexpr static ParametricCoordinate const kParametricCoordinate0_0_{}, kParametricCoordinate0_25_{0.25},
+                                              kParametricCoordinate1_0_{1.0}, kPerturbation_{1.1 * kEpsilon_};
+  constexpr static ParametricCoordinate const &kParametricCoordinate0_0Perturbed_ = (kParametricCoordinate0_0_ -
+                                                                                      kPerturbation_);
+  constexpr static Type_ const k0_0_{}, k1_0_{1.0};
+
+  BSplineBasisSuite();
+
+  KnotVector_ knot_vector_;
+  BSplineBasis basis_;
+};
+
+BSplineBasisSuite::BSplineBasisSuite() {
+  knot_vector_.NurbsBookExa2_1();
+  basis_ = BSplineBasis{knot_vector_, kDegree2_};
+}
+
+TEST_F(BSplineBasisSuite, IsEqualAndOperatorEqual) {
+  BSplineBasis basis;
+  ASSERT_NO_THROW(basis = BSplineBasis(knot_vector_, kDegree2_));
+  EXPECT_TRUE(IsEqual(basis, basis_));
+  EXPECT_TRUE(basis == basis_);
+
+  KnotVector_ knot_vector;
+  ASSERT_NO_THROW(knot_vector.NurbsBookExa2_1Perturbed());
+  BSplineBasis basis_knot_vector;
+  ASSERT_NO_THROW(basis_knot_vector = BSplineBasis(knot_vector, kDegree2_));
+  EXPECT_FALSE(IsEqual(basis_knot_vector, basis_));
+  EXPECT_FALSE(basis_knot_vector == basis_);
+  EXPECT_FALSE(IsEqual(basis_knot_vector, basis_, kTolerance_));
+  ASSERT_NO_THROW(basis_knot_vector = BSplineBasis(knot_vector, kDegree2_, kTolerance_));
+  EXPECT_FALSE(IsEqual(basis_knot_vector, basis_));
+  EXPECT_FALSE(basis_knot_vector == basis_);
+  EXPECT_TRUE(IsEqual(basis_knot_vector, basis_, kTolerance_));
+
+  BSplineBasis basis_degree;
+  ASSERT_NO_THROW(basis_degree = BSplineBasis(knot_vector_, Degree{1}));
+  EXPECT_FALSE(IsEqual(basis_degree, basis_));
+  EXPECT_FALSE(basis_degree == basis_);
+}
+
+TEST_F(BSplineBasisSuite, Evaluate) {
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_25_), Type_{0.5625}));
+  EXPECT_TRUE(IsEqual(basis_(KnotSpan{1}, kParametricCoordinate0_25_), Type_{0.375}));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan2_, kParametricCoordinate0_25_), Type_{0.0625}));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_0_), k1_0_));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate1_0_), k0_0_));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan2_, kParametricCoordinate1_0_), k1_0_));
+
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_0Perturbed_), k0_0_));
+  EXPECT_FALSE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_0Perturbed_, kTolerance_), k1_0_, kTolerance_));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_0Perturbed_, kTolerance_), k1_0_,
+                      kToleranceDegree_));
+}
+
+TEST_F(BSplineBasisSuite, EvaluateDerivative) {
+  constexpr Derivative const kDerivative1{1}, kDerivative2{2};
+
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_25_, kDerivative1), Type_{-1.5}));
+  EXPECT_TRUE(IsEqual(basis_(KnotSpan{1}, kParametricCoordinate0_25_, kDerivative1), Type_{1.0}));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan2_, kParametricCoordinate0_25_, kDerivative1), Type_{0.5}));
+  EXPECT_TRUE(IsEqual(basis_(KnotSpan{1}, kParametricCoordinate0_25_, kDerivative2), Type_{-4.0}));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan2_, kParametricCoordinate1_0_, kDerivative2), Type_{2.0}));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_25_, Derivative{3}), k0_0_));
+  EXPECT_TRUE(IsEqual(basis_(kKnotSpan0_, kParametricCoordinate0_25_, Derivative{}),
+                      basis_(kKnotSpan0_, kParametricCoordinate0_25_)));
+}
+
+#ifndef NDEBUG
+TEST_F(BSplineBasisSuite, ThrowIfStartOfSupportIsInvalid) {
+  EXPECT_THROW(basis_(KnotSpan{3}, kParametricCoordinate0_25_), OutOfRange);
+  EXPECT_THROW(basis_(KnotSpan{4}, kParametricCoordinate0_25_, Derivative{1}), OutOfRange);
+}
+#endif
+
+}  // namespace splinelib::tests::parameter_spaces
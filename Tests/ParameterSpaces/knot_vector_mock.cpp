@@ -69,6 +69,11 @@ KnotSpan AKnotVectorMock::FindSpan(ParametricCoordinate const &parametric_coordi
   return FindSpanMock(parametric_coordinate, tolerance);
 }
 
+KnotSpan AKnotVectorMock::FindSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &,
+                                   Tolerance_ const &tolerance) const {
+  return FindSpanMock(parametric_coordinate, tolerance);
+}
+
 Multiplicity AKnotVectorMock::DetermineMultiplicity(ParametricCoordinate const &knot, Tolerance_ const &tolerance) const
 {  // NOLINT(whitespace/braces)
   return DetermineMultiplicityMock(knot, tolerance);
@@ -124,7 +129,9 @@ void AKnotVectorMock::NurbsBookExa2_1() {
   EXPECT_CALL(*this, DoesParametricCoordinateEqualFrontOrBackMock(k0_0, Ge(0.0))).WillRepeatedly(Return(true));
   EXPECT_CALL(*this, DoesParametricCoordinateEqualFrontOrBackMock(k0_5, IsGe0_0AndLt0_5)).WillRepeatedly(Return(false));
   EXPECT_CALL(*this, DoesParametricCoordinateEqualFrontOrBackMock(k1_0, Ge(0.0))).WillRepeatedly(Return(true));
+  EXPECT_CALL(*this, FindSpanMock(k0_0, Ge(0.0))).WillRepeatedly(Return(KnotSpan{2}));
   EXPECT_CALL(*this, FindSpanMock(k0_5, IsGe0_0AndLt0_5)).WillRepeatedly(Return(KnotSpan{2}));
+  EXPECT_CALL(*this, FindSpanMock(k1_0, Ge(0.0))).WillRepeatedly(Return(KnotSpan{2}));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k0_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(kMultiplicity3));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k0_5, IsGe0_0AndLt0_5)).WillRepeatedly(Return(kMultiplicity0));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k1_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(kMultiplicity3));
@@ -153,9 +160,12 @@ void AKnotVectorMock::NurbsBookExa2_1Perturbed() {
   EXPECT_CALL(*this, OperatorSubscript(kIndex1)).WillRepeatedly(ReturnRef(k0_0));
   EXPECT_CALL(*this, OperatorSubscript(kIndex2)).WillRepeatedly(ReturnRef(k0_0Perturbed));
   EXPECT_CALL(*this, OperatorSubscript(kIndex3)).WillRepeatedly(ReturnRef(k1_0Perturbed));
+  EXPECT_CALL(*this, OperatorSubscript(kIndex4)).WillRepeatedly(ReturnRef(k1_0));
+  EXPECT_CALL(*this, OperatorSubscript(kIndex5)).WillRepeatedly(ReturnRef(k1_0));
   EXPECT_CALL(*this, GetSize).WillRepeatedly(Return(6));
 
   EXPECT_CALL(*this, DoesParametricCoordinateEqualBackMock(k0_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(false));
+  EXPECT_CALL(*this, DoesParametricCoordinateEqualBackMock(k1_0, Ge(0.0))).WillRepeatedly(Return(true));
   EXPECT_CALL(*this, DoesParametricCoordinateEqualBackMock(k0_0Perturbed, IsGe0_0AndLt1_0Perturbed))
       .WillRepeatedly(Return(false));
   EXPECT_CALL(*this, DoesParametricCoordinateEqualBackMock(k1_0Perturbed, IsGe0_0AndLtPerturbation))
@@ -203,7 +213,9 @@ void AKnotVectorMock::NurbsBookExa2_2() {
 #ifndef NDEBUG
   EXPECT_CALL(*this, FindSpanMock(kMinus0_5, Ge(0.0))).WillRepeatedly(Throw(OutOfRange("")));
 #endif
+  EXPECT_CALL(*this, FindSpanMock(k0_0, Ge(0.0))).WillRepeatedly(Return(KnotSpan{2}));
   EXPECT_CALL(*this, FindSpanMock(k1_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(kKnotSpan3));
+  EXPECT_CALL(*this, FindSpanMock(k5_0, Ge(0.0))).WillRepeatedly(Return(KnotSpan{7}));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k0_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(kMultiplicity3));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k0_5, IsGe0_0AndLt0_5)).WillRepeatedly(Return(kMultiplicity0));
   EXPECT_CALL(*this, DetermineMultiplicityMock(k1_0, IsGe0_0AndLt1_0)).WillRepeatedly(Return(kMultiplicity_));
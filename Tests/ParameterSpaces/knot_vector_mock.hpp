@@ -47,6 +47,9 @@ class AKnotVectorMock : public sources::parameter_spaces::KnotVector {
   MOCK_METHOD(KnotSpan, FindSpanMock, (ParametricCoordinate const &, Tolerance_ const &), (const));
   KnotSpan FindSpan(ParametricCoordinate const &parametric_coordinate, Tolerance_ const &tolerance = kEpsilon_) const
       final;
+  // Ignores the knot span hint (see FindSpan without hint).
+  KnotSpan FindSpan(ParametricCoordinate const &parametric_coordinate, KnotSpan const &knot_span_hint,
+                    Tolerance_ const &tolerance = kEpsilon_) const final;
   MOCK_METHOD(Multiplicity, DetermineMultiplicityMock, (ParametricCoordinate const &, Tolerance_ const &), (const));
   Multiplicity DetermineMultiplicity(ParametricCoordinate const &knot, Tolerance_ const &tolerance = kEpsilon_) const;
   MOCK_METHOD(Knots_, GetUniqueKnotsMock, (Tolerance_ const &), (const));
@@ -13,6 +13,8 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include "Sources/ParameterSpaces/knot_vector.hpp"
 #include "Sources/Utilities/error_handling.hpp"
@@ -61,6 +63,11 @@ TEST_F(KnotVectorSuite, GetSize) {
   EXPECT_EQ(knot_vector_.GetSize(), 9);
 }
 
+TEST_F(KnotVectorSuite, GetKnots) {
+  Span<ParametricCoordinate const> const &knots = knot_vector_.GetKnots();
+  EXPECT_TRUE(std::equal(knots.begin(), knots.end(), knots_.begin(), knots_.end()));
+}
+
 TEST_F(KnotVectorSuite, GetFront) {
   EXPECT_EQ(knot_vector_.GetFront(), k0_0_);
 }
@@ -97,6 +104,67 @@ TEST_F(KnotVectorSuite, FindSpan) {
   EXPECT_EQ(knot_vector_.FindSpan(k1_0_), kKnotSpan5);
 }
 
+TEST_F(KnotVectorSuite, FindSpanWithHint) {
+  constexpr KnotSpan const kKnotSpan2{2}, kKnotSpan5{5};
+
+  EXPECT_EQ(knot_vector_.FindSpan(k0_0_, kKnotSpan5), kKnotSpan2);
+  EXPECT_EQ(knot_vector_.FindSpan(k0_75_, kKnotSpan2), kKnotSpan5);
+  EXPECT_EQ(knot_vector_.FindSpan(k0_75Perturbed_, kKnotSpan5), KnotSpan{4});
+  EXPECT_EQ(knot_vector_.FindSpan(k0_75Perturbed_, kKnotSpan2, kTolerance_), kKnotSpan5);
+  EXPECT_EQ(knot_vector_.FindSpan(k1_0_, KnotSpan{}), kKnotSpan5);
+  for (ParametricCoordinate const &parametric_coordinate : {k0_0_, ParametricCoordinate{0.25}, k0_5_,
+                                                            k0_75Perturbed_, k0_75_, k1_0Minus_, k1_0_})
+      for (int knot_span_hint{}; knot_span_hint <= knot_vector_.GetSize(); ++knot_span_hint)
+          EXPECT_EQ(knot_vector_.FindSpan(parametric_coordinate, KnotSpan{knot_span_hint}),
+                    knot_vector_.FindSpan(parametric_coordinate));
+}
+
+TEST_F(KnotVectorSuite, GetUniformKnotSpacingAndFindSpanOfUniformKnotVectors) {
+  constexpr ParametricCoordinate const k0_25{0.25};
+
+  KnotVector uniform_knot_vector{{k0_0_, k0_0_, k0_25, k0_5_, k0_5_, k0_75_, k1_0_, k1_0_}};
+  EXPECT_EQ(knot_vector_.GetUniformKnotSpacing(), 0.0);
+  EXPECT_DOUBLE_EQ(uniform_knot_vector.GetUniformKnotSpacing(), 0.25);
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k0_0_), KnotSpan{1});
+  EXPECT_EQ(uniform_knot_vector.FindSpan(ParametricCoordinate{0.3}), KnotSpan{2});
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k0_5Perturbed_), KnotSpan{2});
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k0_5Perturbed_, kTolerance_), KnotSpan{4});
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k1_0Minus_), KnotSpan{5});
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k1_0_), KnotSpan{5});
+  uniform_knot_vector.Insert(ParametricCoordinate{0.125});
+  EXPECT_EQ(uniform_knot_vector.GetUniformKnotSpacing(), 0.0);
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k0_5_), KnotSpan{5});
+  uniform_knot_vector.Remove(ParametricCoordinate{0.125});
+  EXPECT_DOUBLE_EQ(uniform_knot_vector.GetUniformKnotSpacing(), 0.25);
+  EXPECT_EQ(uniform_knot_vector.FindSpan(k0_5_), KnotSpan{4});
+}
+
+TEST_F(KnotVectorSuite, GetUniformKnotSpacingAndFindSpanOfPiecewiseUniformKnotVectors) {
+  constexpr ParametricCoordinate const k0_125{0.125}, k0_25{0.25};
+  constexpr KnotSpan const kKnotSpan5{5};
+
+  KnotVector piecewise_uniform_knot_vector{{k0_0_, k0_0_, k0_0_, k0_125, k0_25, k0_5_, k0_75_, k1_0_, k1_0_, k1_0_}};
+  EXPECT_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(), 0.0);
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(ParametricCoordinate{0.1}), KnotSpan{2});
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(k0_125), KnotSpan{3});
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(k0_25), KnotSpan{4});
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(k0_5Perturbed_), KnotSpan{4});
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(k0_5Perturbed_, kTolerance_), kKnotSpan5);
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(ParametricCoordinate{0.8}), KnotSpan{6});
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(k1_0_), KnotSpan{6});
+  EXPECT_DOUBLE_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(KnotSpan{3}, 1), 0.125);
+  EXPECT_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(KnotSpan{2}, 2), 0.0);
+  EXPECT_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(KnotSpan{4}, 2), 0.0);
+  EXPECT_DOUBLE_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(kKnotSpan5, 2), 0.25);
+  EXPECT_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(KnotSpan{6}, 2), 0.0);
+  EXPECT_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(kKnotSpan5, 3), 0.0);
+  for (ParametricCoordinate const &knot : {ParametricCoordinate{0.375}, ParametricCoordinate{0.625},
+                                           ParametricCoordinate{0.875}}) piecewise_uniform_knot_vector.Insert(knot);
+  EXPECT_DOUBLE_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(), 0.125);
+  EXPECT_DOUBLE_EQ(piecewise_uniform_knot_vector.GetUniformKnotSpacing(KnotSpan{6}, 3), 0.125);
+  EXPECT_EQ(piecewise_uniform_knot_vector.FindSpan(ParametricCoordinate{0.8}), KnotSpan{8});
+}
+
 TEST_F(KnotVectorSuite, DetermineMultiplicity) {
   EXPECT_EQ(knot_vector_.DetermineMultiplicity(k0_0_), Multiplicity{3});
   Multiplicity multiplicity;
@@ -178,6 +246,33 @@ TEST_F(KnotVectorSuite, DecreaseMultiplicitiesDependingOnGetUniqueKnots) {
   EXPECT_EQ(knot_vector_minimum, KnotVector(knots));
 }
 
+TEST_F(KnotVectorSuite, DetermineMultiplicityAndGetUniqueKnotsAfterModifications) {
+  constexpr sources::parameter_spaces::Tolerance const kOtherTolerance{0.5 * kEpsilon_};
+  constexpr ParametricCoordinate const kKnot{0.25};
+
+  auto const &expect_breakpoints_to_be_up_to_date = [&] {
+      EXPECT_EQ(knot_vector_.GetUniqueKnots(), knot_vector_.GetUniqueKnots(kOtherTolerance));
+      for (ParametricCoordinate const &knot : {k0_0_, kKnot, k0_5_, k0_75Perturbed_, k0_75_, k1_0_})
+          EXPECT_EQ(knot_vector_.DetermineMultiplicity(knot), knot_vector_.DetermineMultiplicity(knot,
+                                                                                                 kOtherTolerance)); };
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.Insert(kKnot, kMultiplicity2_));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.Insert(k1_0_));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.Remove(k0_75_));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.Remove(kKnot));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.IncreaseMultiplicities(kMultiplicity2_));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.DecreaseMultiplicities(Multiplicity{3}));
+  expect_breakpoints_to_be_up_to_date();
+  ASSERT_NO_THROW(knot_vector_.Insert(kKnot, kMultiplicity1_, kOtherTolerance));
+  expect_breakpoints_to_be_up_to_date();
+  EXPECT_EQ(knot_vector_, KnotVector({k0_0_, k0_0_, kKnot, k0_5_, k1_0_, k1_0_, k1_0_}));
+}
+
 TEST_F(KnotVectorSuite, Write) {
   using sources::utilities::string_operations::Write;
 
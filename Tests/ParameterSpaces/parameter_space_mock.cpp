@@ -15,10 +15,10 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 
 #include "Tests/ParameterSpaces/parameter_space_mock.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include "Tests/ParameterSpaces/knot_vector_mock.hpp"
-#include "Tests/ParameterSpaces/b_spline_basis_function_mock.hpp"
 #include "Tests/ParameterSpaces/non_zero_degree_b_spline_basis_function_mock.hpp"
 
 namespace splinelib::tests::parameter_spaces {
@@ -29,7 +29,7 @@ MATCHER_P2(IsGeAndLt, minimum, supremum, "") {
   return ((minimum <= arg) && (arg < supremum));
 }
 
-using std::tuple_element_t;
+using sources::parameter_spaces::BSplineBasis, sources::parameter_spaces::KnotVector, std::tuple_element_t;
 using BezierInformation = A2dParameterSpaceMock::BezierInformation_;
 using BinomialRatios = A2dParameterSpaceMock::BinomialRatios_;
 using Degrees = A2dParameterSpaceMock::Degrees_;
@@ -39,12 +39,15 @@ using ElevationInformation = A2dParameterSpaceMock::ElevationInformation_;
 using Index = A2dParameterSpaceMock::Index_;
 using IndexLength = Index::Length_;
 using InsertionInformation = A2dParameterSpaceMock::InsertionInformation_;
+using NonZeroBasisFunctionDerivatives = A2dParameterSpaceMock::NonZeroBasisFunctionDerivatives_;
+using NonZeroBasisFunctions = A2dParameterSpaceMock::NonZeroBasisFunctions_;
 using ParametricCoordinate = A2dParameterSpaceMock::ParametricCoordinate_;
+using RefinementInformation = A2dParameterSpaceMock::RefinementInformation_;
 using ScalarIndex = Index::Value_::value_type;
 using ScalarParametricCoordinate = ParametricCoordinate::value_type;
 using Type = A2dParameterSpaceMock::Type_;
-using testing::AnyNumber, testing::DoAll, testing::Ge, testing::InvokeWithoutArgs, testing::Lt, testing::Return,
-      testing::StrictMock, testing::Throw;
+using testing::_, testing::AnyNumber, testing::DoAll, testing::Ge, testing::Invoke, testing::InvokeWithoutArgs,
+      testing::Lt, testing::Return, testing::StrictMock, testing::Throw;
 
 constexpr BinomialRatios::value_type const kOneSixth{1.0 / 6.0}, kOneFourth{0.25}, kOneThird{1.0 / 3.0}, kOneHalf{0.5},
                                            kTwoThirds{2.0 / 3.0}, kThreeFourths{0.75};
@@ -94,6 +97,11 @@ BezierInformation A2dParameterSpaceMock::DetermineBezierExtractionKnots(Dimensio
   return DetermineBezierExtractionKnotsMock(dimension, tolerance);
 }
 
+A2dParameterSpaceMock::BezierExtractionOperators_ A2dParameterSpaceMock::DetermineBezierExtractionOperators(
+    Dimension const &dimension, Tolerance_ const &tolerance) const {
+  return DetermineBezierExtractionOperatorsMock(dimension, tolerance);
+}
+
 Type A2dParameterSpaceMock::EvaluateBasisFunction(Index_ const &basis_function_index,
     ParametricCoordinate_ const &parametric_coordinate, Tolerance_ const &tolerance) const {
   return EvaluateBasisFunctionMock(basis_function_index, parametric_coordinate, tolerance);
@@ -105,16 +113,93 @@ Type A2dParameterSpaceMock::EvaluateBasisFunctionDerivative(Index_ const &basis_
   return EvaluateBasisFunctionDerivativeMock(basis_function_index, parametric_coordinate, derivative, tolerance);
 }
 
+NonZeroBasisFunctions A2dParameterSpaceMock::EvaluateNonZeroBasisFunctions(
+    ParametricCoordinate_ const &parametric_coordinate, Tolerance_ const &tolerance) const {
+  return EvaluateNonZeroBasisFunctionsMock(parametric_coordinate, tolerance);
+}
+
+NonZeroBasisFunctions A2dParameterSpaceMock::EvaluateNonZeroBasisFunctions(
+    ParametricCoordinate_ const &parametric_coordinate, KnotSpans_ &, Tolerance_ const &tolerance) const {
+  return EvaluateNonZeroBasisFunctionsMock(parametric_coordinate, tolerance);
+}
+
+void A2dParameterSpaceMock::FindKnotSpans(Span<ParametricCoordinate_ const> parametric_coordinates,
+                                          Span<KnotSpans_> knot_spans, Tolerance_ const &tolerance) const {
+  for (int coordinate{}; coordinate < static_cast<int>(parametric_coordinates.size()); ++coordinate) {
+    auto const &[first_non_zero_basis_function, values] =
+        EvaluateNonZeroBasisFunctionsMock(parametric_coordinates[coordinate], tolerance);
+    for (int dimension{}; dimension < 2; ++dimension)
+        knot_spans[coordinate][dimension] = KnotSpan{first_non_zero_basis_function[Dimension{dimension}].Get() +
+                                                     static_cast<int>(values[dimension].size()) - 1};
+  }
+}
+
+void A2dParameterSpaceMock::EvaluateNonZeroBasisFunctions(LaneMajorValues_ const &parametric_coordinates,
+                                                          KnotSpans_ const &, LaneMajorValues_ &values) const {
+  int const number_of_lanes{static_cast<int>(parametric_coordinates[0].size())};
+  for (int lane{}; lane < number_of_lanes; ++lane) {
+    ParametricCoordinate_ parametric_coordinate;
+    for (int dimension{}; dimension < 2; ++dimension)
+        parametric_coordinate[dimension] = ParametricCoordinate_::value_type{parametric_coordinates[dimension][lane]};
+    NonZeroBasisFunctions_ const &non_zero_basis_functions = EvaluateNonZeroBasisFunctionsMock(parametric_coordinate,
+                                                                                               kEpsilon_);
+    for (int dimension{}; dimension < 2; ++dimension) {
+      Vector<Type_> const &lane_values = std::get<1>(non_zero_basis_functions)[dimension];
+      int const number_of_values{static_cast<int>(lane_values.size())};
+      values[dimension].resize(number_of_values * number_of_lanes);
+      for (int value{}; value < number_of_values; ++value)
+          values[dimension][value * number_of_lanes + lane] = lane_values[value];
+    }
+  }
+}
+
+NonZeroBasisFunctionDerivatives A2dParameterSpaceMock::EvaluateNonZeroBasisFunctionDerivatives(
+    ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative,
+    Tolerance_ const &tolerance) const {
+  return EvaluateNonZeroBasisFunctionDerivativesMock(parametric_coordinate, maximum_derivative, tolerance);
+}
+
+NonZeroBasisFunctionDerivatives A2dParameterSpaceMock::EvaluateNonZeroBasisFunctionDerivatives(
+    ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative, KnotSpans_ &,
+    Tolerance_ const &tolerance) const {
+  return EvaluateNonZeroBasisFunctionDerivativesMock(parametric_coordinate, maximum_derivative, tolerance);
+}
+
+void A2dParameterSpaceMock::EvaluateNonZeroBasisFunctionDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+    Derivative_ const &maximum_derivative, DerivativesWorkspace_ &workspace, Tolerance_ const &tolerance) const {
+  auto const &[first_non_zero_basis_function, basis_function_derivatives] =
+      EvaluateNonZeroBasisFunctionDerivativesMock(parametric_coordinate, maximum_derivative, tolerance);
+  workspace.SetFirstNonZeroBasisFunction(first_non_zero_basis_function);
+  for (int dimension{}; dimension < 2; ++dimension) {
+    Vector<Vector<Type_>> const &derivatives = basis_function_derivatives[dimension];
+    int const number_of_values{static_cast<int>(derivatives.front().size())};
+    Span<Type_> const &stored_derivatives = workspace.Resize(Dimension{dimension}, number_of_values,
+                                                             static_cast<int>(derivatives.size()));
+    for (int derivative{}; derivative < static_cast<int>(derivatives.size()); ++derivative)
+        std::copy(derivatives[derivative].begin(), derivatives[derivative].end(),
+                  stored_derivatives.begin() + derivative * number_of_values);
+  }
+}
+
 InsertionInformation A2dParameterSpaceMock::InsertKnot(Dimension const &dimension, Knot_ knot,
                                                        Multiplicity const &multiplicity, Tolerance_ const &tolerance) {
   return InsertKnotMock(dimension, std::move(knot), multiplicity, tolerance);
 }
 
+RefinementInformation A2dParameterSpaceMock::RefineKnots(Dimension const &dimension, Knots_ knots,
+    Multiplicity const &multiplicity, Tolerance_ const &tolerance) {
+  return RefineKnotsMock(dimension, std::move(knots), multiplicity, tolerance);
+}
+
 InsertionInformation A2dParameterSpaceMock::RemoveKnot(Dimension const &dimension, Knot_ const &knot,
                                                        Multiplicity const &multiplicity, Tolerance_ const &tolerance) {
   return RemoveKnotMock(dimension, knot, multiplicity, tolerance);
 }
 
+void A2dParameterSpaceMock::RemoveKnots(Dimension const &dimension, Knots_ const &knots, Tolerance_ const &tolerance) {
+  RemoveKnotsMock(dimension, knots, tolerance);
+}
+
 ElevationInformation A2dParameterSpaceMock::ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity,
                                                            Tolerance_ const &tolerance) {
   return ElevateDegreeMock(dimension, multiplicity, tolerance);
@@ -125,6 +210,11 @@ ElevationInformation A2dParameterSpaceMock::ReduceDegree(Dimension const &dimens
   return ReduceDegreeMock(dimension, multiplicity, tolerance);
 }
 
+A2dParameterSpaceMock::SampledNonZeroBasisFunctions_ A2dParameterSpaceMock::SampleNonZeroBasisFunctions(
+    NumberOfParametricCoordinates_ const &number_of_parametric_coordinates, Tolerance_ const &tolerance) const {
+  return SampleNonZeroBasisFunctionsMock(number_of_parametric_coordinates, tolerance);
+}
+
 A2dParameterSpaceMock::OutputInformation_ A2dParameterSpaceMock::Write(Precision const &precision) const {
   return WriteMock(precision);
 }
@@ -156,7 +246,7 @@ void A2dParameterSpaceMock::NurbsBookExe3_8() {
                               {kIndex2, kIndex2}}, kBasisFunction3_2{kNumberOfBasisFunctions, {kIndex3, kIndex2}};
 
   NurbsBookExe3_8KnotVectorsDegrees();
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   StrictMock<ANonZeroDegreeBSplineBasisFunctionMock> basis_function_for_dimension_one0;
   basis_function_for_dimension_one0.NurbsBookExa2_1_0_2();
@@ -180,6 +270,44 @@ void A2dParameterSpaceMock::NurbsBookExe3_8() {
       .WillRepeatedly(Return(kBezierInformation));
   EXPECT_CALL(*this, DetermineBezierExtractionKnotsMock(kDimension1, IsGe0_0AndLt0_5))
       .WillRepeatedly(Return(BezierInformation_{1, {}}));
+  EXPECT_CALL(*this, DetermineBezierExtractionOperatorsMock(kDimension0, IsGe0_0AndLt0_5))
+      .WillRepeatedly(Return(BezierExtractionOperators_{{kIndex0, {{k1_0, k0_0, k0_0}, {k0_0, k1_0, k0_5}, {k0_0, k0_0,
+          k0_5}}}, {kIndex1, {{k0_5, k0_0, k0_0}, {k0_5, k1_0, k0_0}, {k0_0, k0_0, k1_0}}}}));
+  EXPECT_CALL(*this, DetermineBezierExtractionOperatorsMock(kDimension1, IsGe0_0AndLt0_5))
+      .WillRepeatedly(Return(BezierExtractionOperators_{{kIndex0, {{k1_0, k0_0, k0_0}, {k0_0, k1_0, k0_0}, {k0_0, k0_0,
+          k1_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate0, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k1_0, k0_0, k0_0}, {k1_0, k0_0, k0_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction1_0, {{{k0_0, k0_0, k1_0}, {k1_0, k0_0, k0_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate2, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k1_0, k0_0, k0_0}, {k0_0, k0_0, k1_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate3, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction1_0, {{{k0_0, k0_0, k1_0}, {k0_0, k0_0, k1_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction1_0, {{{k0_125, k0_625, k0_25}, {k0_25, k0_5,
+                                                                                                     k0_25}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate0, kDerivative1_0, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction0_0, {{{{k1_0, k0_0, k0_0},
+          {Type{-4.0}, Type{4.0}, k0_0}}, {{k1_0, k0_0, k0_0}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate0, kDerivative0_1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction0_0, {{{{k1_0, k0_0, k0_0}},
+          {{k1_0, k0_0, k0_0}, {Type{-2.0}, k2_0, k0_0}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate0, kDerivative1_1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction0_0, {{{{k1_0, k0_0, k0_0},
+          {Type{-4.0}, Type{4.0}, k0_0}}, {{k1_0, k0_0, k0_0}, {Type{-2.0}, k2_0, k0_0}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate, kDerivative0_0, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction1_0, {{{{k0_125, k0_625, k0_25}},
+          {{k0_25, k0_5, k0_25}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate, kDerivative1_0, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction1_0, {{{{k0_125, k0_625, k0_25},
+          {k1_0, kMinus1_0, k2_0}}, {{k0_25, k0_5, k0_25}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate, kDerivative0_1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction1_0, {{{{k0_125, k0_625, k0_25}},
+          {{k0_25, k0_5, k0_25}, {kMinus1_0, k0_0, k1_0}}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(kParametricCoordinate, kDerivative1_1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctionDerivatives_{kBasisFunction1_0, {{{{k0_125, k0_625, k0_25},
+          {k1_0, kMinus1_0, k2_0}}, {{k0_25, k0_5, k0_25}, {kMinus1_0, k0_0, k1_0}}}}}));
 
   EXPECT_CALL(*this, EvaluateBasisFunctionMock(kBasisFunction0_0, kParametricCoordinate0, Ge(0.0)))
       .WillRepeatedly(Return(k1_0));
@@ -419,13 +547,28 @@ void A2dParameterSpaceMock::NurbsBookExe3_8() {
   EXPECT_CALL(*this, InsertKnotMock(kDimension1, kParametricCoordinate0_5, kMultiplicity2, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8Subdivided),
                             Return(kInsertionInformationSubdivided)));
+  EXPECT_CALL(*this, RefineKnotsMock(kDimension1, Knots_{kParametricCoordinate0_5, kParametricCoordinate0_5},
+                                     kMultiplicity_, IsGe0_0AndLt0_5))
+      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8Subdivided),
+          Return(RefinementInformation{KnotVector{*knot_vectors_[1]}, {kParametricCoordinate0_5,
+                                                                       kParametricCoordinate0_5}})));
   EXPECT_CALL(*this, RemoveKnotMock(kDimension1, kParametricCoordinate0_5, kMultiplicity_, IsGeAndLt(0.0, 1.0)))
       .WillRepeatedly(Return(InsertionInformation{}));
+  EXPECT_CALL(*this, GetKnotVector(kDimension0)).WillRepeatedly(Return(KnotVector{*knot_vectors_[0]}));
+  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity_, IsGe0_0AndLt0_5))
+      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8ElevateReduce),
+                            Return(kElevationInformationOnce)));
+  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity2, IsGe0_0AndLt0_5))
+      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8ElevatedTwice),
+                            Return(kElevationInformationTwice)));
   EXPECT_CALL(*this, ReduceDegreeMock(kDimension1, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(Return(InsertionInformation_{kIndex1, {kBinomialRatios}}));
 
   EXPECT_CALL(*this, Sample(kNumberOfParametricCoordinates)).WillRepeatedly(Return(ParametricCoordinates_{
       kParametricCoordinate0, kParametricCoordinate1, kParametricCoordinate2, kParametricCoordinate3}));
+  EXPECT_CALL(*this, SampleNonZeroBasisFunctionsMock(kNumberOfParametricCoordinates, Ge(0.0)))
+      .WillRepeatedly(Return(SampledNonZeroBasisFunctions_{{{{kIndex0, {k1_0, k0_0, k0_0}}, {kIndex1, {k0_0, k0_0,
+          k1_0}}}, {{kIndex0, {k1_0, k0_0, k0_0}}, {kIndex0, {k0_0, k0_0, k1_0}}}}}));
   EXPECT_CALL(*this, WriteMock(kPrecision_)).WillRepeatedly(Return(OutputInformation_{{{knot_vectors_[0]->Write(),
       knot_vectors_[1]->Write()}}, {Write<DegreesOutput>(degrees_)}, {Write<tuple_element_t<2, OutputInformation_>>(
                                                                           kNumberOfBasisFunctions)}}));
@@ -441,10 +584,15 @@ void A2dParameterSpaceMock::NurbsBookExe3_8() {
 void A2dParameterSpaceMock::NurbsBookExe3_8ElevateReduce() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe3_8IncreaseDecrease();
   degrees_ = Degrees_{Degree{3}, kDegree2};
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   EXPECT_CALL(*this, GetNumberOfBasisFunctions()).WillRepeatedly(Return(IndexLength{Length{6}, kLength3}));
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(18));
+  EXPECT_CALL(*this, GetKnotVector(kDimension0)).WillRepeatedly(Return(KnotVector{*knot_vectors_[0]}));
+
+  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity_, IsGe0_0AndLt0_5))
+      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8ElevatedTwice),
+                            Return(kElevationInformationElevateReduce)));
 
   EXPECT_CALL(*this, InsertKnotMock(kDimension0, kParametricCoordinate0_5, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8BezierElevateReduce),
@@ -454,7 +602,7 @@ void A2dParameterSpaceMock::NurbsBookExe3_8ElevateReduce() {
 void A2dParameterSpaceMock::NurbsBookExe3_8ElevatedTwice() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe3_8IncreasedTwice();
   degrees_ = Degrees_{Degree{4}, kDegree2};
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   EXPECT_CALL(*this, GetNumberOfBasisFunctions()).WillRepeatedly(Return(IndexLength{Length{8}, kLength3}));
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(24));
@@ -486,7 +634,7 @@ void A2dParameterSpaceMock::NurbsBookExe3_8InsertRemove() {
 void A2dParameterSpaceMock::NurbsBookExe3_8KnotVector() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe3_8Perturbed();
   degrees_ = kDegrees2_2;
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(12));
 }
@@ -494,10 +642,11 @@ void A2dParameterSpaceMock::NurbsBookExe3_8KnotVector() {
 void A2dParameterSpaceMock::NurbsBookExe3_8Subdivided() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe3_8Subdivided();
   degrees_ = kDegrees2_2;
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   EXPECT_CALL(*this, GetNumberOfBasisFunctions()).WillRepeatedly(Return(NumberOfBasisFunctions_{kLength4, Length{5}}));
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(20));
+  EXPECT_CALL(*this, GetKnotVector(kDimension1)).WillRepeatedly(Return(KnotVector{*knot_vectors_[1]}));
 
   EXPECT_CALL(*this, RemoveKnotMock(kDimension1, kParametricCoordinate0_5, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8InsertRemove),
@@ -505,6 +654,9 @@ void A2dParameterSpaceMock::NurbsBookExe3_8Subdivided() {
   EXPECT_CALL(*this, RemoveKnotMock(kDimension1, kParametricCoordinate0_5, kMultiplicity2, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8),
                             Return(kInsertionInformationSubdivided)));
+  EXPECT_CALL(*this, RemoveKnotsMock(kDimension1, Knots_{kParametricCoordinate0_5, kParametricCoordinate0_5},
+                                     IsGe0_0AndLt0_5))
+      .WillRepeatedly(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8));
 }
 
 void A2dParameterSpaceMock::NurbsBookExe3_8Unsuccessful() {
@@ -518,11 +670,42 @@ void A2dParameterSpaceMock::NurbsBookExe3_8Unsuccessful() {
 void A2dParameterSpaceMock::NurbsBookExe4_4() {
   String const kOneString{sources::utilities::string_operations::Write(kIndex1)};
 
+  constexpr IndexLength const kNumberOfBasisFunctions{kLength2, kLength2};
+  constexpr ParametricCoordinate_ const kParametricCoordinate{kParametricCoordinate0_5, kParametricCoordinate0_5};
+  constexpr Type const k0_0{}, k0_5{0.5}, k1_0{1.0};
+  Index_ const kBasisFunction0_0{kNumberOfBasisFunctions, {}};
+  // The derivatives of the linear Bezier basis functions {1-u; u} are {-1; 1} and zero beyond.
+  auto const &evaluate_non_zero_basis_function_derivatives = [=] (ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance_ const &) {
+      BasisFunctionDerivatives_ basis_function_derivatives;
+      for (int dimension{}; dimension < 2; ++dimension) {
+        Type const parametric_coordinate_value{parametric_coordinate[dimension].Get()};
+        Vector<Vector<Type>> &derivatives = basis_function_derivatives[dimension];
+        derivatives.assign(maximum_derivative[dimension].Get() + 1, {k0_0, k0_0});
+        derivatives[0] = {k1_0 - parametric_coordinate_value, parametric_coordinate_value};
+        if (derivatives.size() > 1) derivatives[1] = {-k1_0, k1_0};
+      }
+      return NonZeroBasisFunctionDerivatives_{kBasisFunction0_0, basis_function_derivatives}; };
+
   NurbsBookExe4_4KnotVectorsDegrees();
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
+  EXPECT_CALL(*this, GetNumberOfBasisFunctions()).WillRepeatedly(Return(kNumberOfBasisFunctions));
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(4));
 
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate0, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k1_0, k0_0}, {k1_0, k0_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate1, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k0_0, k1_0}, {k1_0, k0_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate2, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k1_0, k0_0}, {k0_0, k1_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate3, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k0_0, k1_0}, {k0_0, k1_0}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionsMock(kParametricCoordinate, Ge(0.0)))
+      .WillRepeatedly(Return(NonZeroBasisFunctions_{kBasisFunction0_0, {{{k0_5, k0_5}, {k0_5, k0_5}}}}));
+  EXPECT_CALL(*this, EvaluateNonZeroBasisFunctionDerivativesMock(_, _, Ge(0.0)))
+      .WillRepeatedly(Invoke(evaluate_non_zero_basis_function_derivatives));
+
   EXPECT_CALL(*this, Sample(kNumberOfParametricCoordinates)).WillRepeatedly(Return(ParametricCoordinates_{
       kParametricCoordinate0, kParametricCoordinate1, kParametricCoordinate2, kParametricCoordinate3}));
 
@@ -544,19 +727,19 @@ void A2dParameterSpaceMock::NurbsBookExe4_4() {
 void A2dParameterSpaceMock::NurbsBookExe4_4KnotVector() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe4_4Perturbed();
   degrees_ = kDegrees1_1;
-  basis_functions_ = mock_b_spline_basis_functions::Empty();
+  bases_ = BSplineBases_{};
 
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(4));
 }
 
 void A2dParameterSpaceMock::SquareUnitFirstOrderBezier() {
   NurbsBookExe4_4KnotVectorsDegrees();
-  basis_functions_ = mock_b_spline_basis_functions::NurbsBookExe4_4();
+  CreateBSplineBases();
 }
 
 void A2dParameterSpaceMock::SquareUnitSecondOrderMaximallySmooth() {
   NurbsBookExe3_8KnotVectorsDegrees();
-  basis_functions_ = mock_b_spline_basis_functions::NurbsBookExe3_8();
+  CreateBSplineBases();
 }
 
 void A2dParameterSpaceMock::NurbsBookExe3_8Bezier() {
@@ -565,12 +748,6 @@ void A2dParameterSpaceMock::NurbsBookExe3_8Bezier() {
   EXPECT_CALL(*this, RemoveKnotMock(kDimension0, kParametricCoordinate0_5, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8),
                             Return(kInsertionInformationInsertRemove)));
-  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity_, IsGe0_0AndLt0_5))
-      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8BezierElevateReduce),
-                            Return(kElevationInformationOnce)));
-  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity2, IsGe0_0AndLt0_5))
-      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8BezierElevatedTwice),
-                            Return(kElevationInformationTwice)));
 }
 
 void A2dParameterSpaceMock::NurbsBookExe3_8BezierElevateReduce() {
@@ -579,9 +756,6 @@ void A2dParameterSpaceMock::NurbsBookExe3_8BezierElevateReduce() {
   EXPECT_CALL(*this, RemoveKnotMock(kDimension0, kParametricCoordinate0_5, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8ElevateReduce),
                             Return(kInsertionInformationElevateReduce)));
-  EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity_, IsGe0_0AndLt0_5))
-      .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8BezierElevatedTwice),
-                            Return(kElevationInformationElevateReduce)));
   EXPECT_CALL(*this, ReduceDegreeMock(kDimension0, kMultiplicity_, IsGe0_0AndLt0_5))
       .WillRepeatedly(DoAll(InvokeWithoutArgs(this, &A2dParameterSpaceMock::NurbsBookExe3_8Bezier),
                             Return(kElevationInformationOnce)));
@@ -604,7 +778,7 @@ void A2dParameterSpaceMock::NurbsBookExe3_8BezierElevatedTwice() {
 void A2dParameterSpaceMock::NurbsBookExe3_8InsertRemoveKnotVectorsDegreesBasisFunctions() {
   knot_vectors_ = mock_knot_vectors::NurbsBookExe3_8InsertRemove();
   degrees_ = kDegrees2_2;
-  basis_functions_ = mock_b_spline_basis_functions::NurbsBookExe3_8InsertRemove();
+  CreateBSplineBases();
 
   EXPECT_CALL(*this, GetNumberOfBasisFunctions()).WillRepeatedly(Return(NumberOfBasisFunctions_{kLength4, kLength4}));
   EXPECT_CALL(*this, GetTotalNumberOfBasisFunctions()).WillRepeatedly(Return(16));
@@ -620,4 +794,12 @@ void A2dParameterSpaceMock::NurbsBookExe4_4KnotVectorsDegrees() {
   degrees_ = kDegrees1_1;
 }
 
+// The knot vector mocks are copied as they are not prepared for creating B-spline bases.
+void A2dParameterSpaceMock::CreateBSplineBases() {
+  Dimension::ForEach(0, 2, [&] (Dimension const &dimension) {
+      Dimension::Type_ const &current_dimension = dimension.Get();
+      bases_[current_dimension] = BSplineBasis{KnotVector{*knot_vectors_[current_dimension]},
+                                               degrees_[current_dimension]}; });
+}
+
 }  // namespace splinelib::tests::parameter_spaces
@@ -23,6 +23,7 @@ namespace splinelib::tests::parameter_spaces {
 
 class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2> {
  private:
+  using KnotVector_ = sources::parameter_spaces::KnotVector;
   using Tolerance_ = sources::parameter_spaces::Tolerance;
 
   constexpr static Multiplicity const &kMultiplicity_ = sources::parameter_spaces::kMultiplicity;
@@ -35,6 +36,7 @@ class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2
 
   MOCK_METHOD(NumberOfBasisFunctions_, GetNumberOfBasisFunctions, (), (const, final));
   MOCK_METHOD(int, GetTotalNumberOfBasisFunctions, (), (const, final));
+  MOCK_METHOD(KnotVector_, GetKnotVector, (Dimension const &), (const, final));
 
   MOCK_METHOD(Index_, FindFirstNonZeroBasisFunctionMock, (ParametricCoordinate_ const &, Tolerance_ const &), (const));
   Index_ FindFirstNonZeroBasisFunction(ParametricCoordinate_ const &parametric_coordinate,
@@ -42,6 +44,10 @@ class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2
   MOCK_METHOD(BezierInformation_, DetermineBezierExtractionKnotsMock, (Dimension const &, Tolerance_ const &), (const));
   BezierInformation_ DetermineBezierExtractionKnots(Dimension const &dimension, Tolerance_ const &tolerance = kEpsilon_)
       const final;
+  MOCK_METHOD(BezierExtractionOperators_, DetermineBezierExtractionOperatorsMock, (Dimension const &,
+                                                                                  Tolerance_ const &), (const));
+  BezierExtractionOperators_ DetermineBezierExtractionOperators(Dimension const &dimension,
+                                                                Tolerance_ const &tolerance = kEpsilon_) const final;
 
   MOCK_METHOD(Type_, EvaluateBasisFunctionMock, (Index_ const &, ParametricCoordinate_ const &, Tolerance_ const &),
               (const));
@@ -52,15 +58,47 @@ class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2
   Type_ EvaluateBasisFunctionDerivative(Index_ const &basis_function_index,
       ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
       Tolerance_ const &tolerance = kEpsilon_) const final;
+  MOCK_METHOD(NonZeroBasisFunctions_, EvaluateNonZeroBasisFunctionsMock, (ParametricCoordinate_ const &,
+                                                                           Tolerance_ const &), (const));
+  NonZeroBasisFunctions_ EvaluateNonZeroBasisFunctions(ParametricCoordinate_ const &parametric_coordinate,
+                                                       Tolerance_ const &tolerance = kEpsilon_) const final;
+  // Ignores the knot span hints (see EvaluateNonZeroBasisFunctions without hints).
+  NonZeroBasisFunctions_ EvaluateNonZeroBasisFunctions(ParametricCoordinate_ const &parametric_coordinate,
+      KnotSpans_ &knot_spans, Tolerance_ const &tolerance = kEpsilon_) const final;
+  // Determines the knot spans from EvaluateNonZeroBasisFunctionsMock.
+  void FindKnotSpans(Span<ParametricCoordinate_ const> parametric_coordinates, Span<KnotSpans_> knot_spans,
+                     Tolerance_ const &tolerance = kEpsilon_) const final;
+  // Evaluates each lane separately by means of EvaluateNonZeroBasisFunctionsMock.
+  void EvaluateNonZeroBasisFunctions(LaneMajorValues_ const &parametric_coordinates, KnotSpans_ const &knot_spans,
+                                     LaneMajorValues_ &values) const final;
+  MOCK_METHOD(NonZeroBasisFunctionDerivatives_, EvaluateNonZeroBasisFunctionDerivativesMock,
+              (ParametricCoordinate_ const &, Derivative_ const &, Tolerance_ const &), (const));
+  NonZeroBasisFunctionDerivatives_ EvaluateNonZeroBasisFunctionDerivatives(
+      ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative,
+      Tolerance_ const &tolerance = kEpsilon_) const final;
+  // Ignores the knot span hints (see EvaluateNonZeroBasisFunctionDerivatives without hints).
+  NonZeroBasisFunctionDerivatives_ EvaluateNonZeroBasisFunctionDerivatives(
+      ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &maximum_derivative, KnotSpans_ &knot_spans,
+      Tolerance_ const &tolerance = kEpsilon_) const final;
+  // Copies the derivatives from EvaluateNonZeroBasisFunctionDerivativesMock into the workspace.
+  void EvaluateNonZeroBasisFunctionDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, DerivativesWorkspace_ &workspace,
+      Tolerance_ const &tolerance = kEpsilon_) const final;
 
   MOCK_METHOD(InsertionInformation_, InsertKnotMock, (Dimension const &, Knot_, Multiplicity const &,
                                                       Tolerance_ const &), ());
   InsertionInformation_ InsertKnot(Dimension const &dimension, Knot_ knot,
       Multiplicity const &multiplicity = kMultiplicity_, Tolerance_ const &tolerance = kEpsilon_) final;
+  MOCK_METHOD(RefinementInformation_, RefineKnotsMock, (Dimension const &, Knots_, Multiplicity const &,
+                                                        Tolerance_ const &), ());
+  RefinementInformation_ RefineKnots(Dimension const &dimension, Knots_ knots,
+      Multiplicity const &multiplicity = kMultiplicity_, Tolerance_ const &tolerance = kEpsilon_) final;
   MOCK_METHOD(InsertionInformation_, RemoveKnotMock, (Dimension const &, Knot_ const &, Multiplicity const &,
                                                       Tolerance_ const &), ());
   InsertionInformation_ RemoveKnot(Dimension const &dimension, Knot_ const &knot,
       Multiplicity const &multiplicity = kMultiplicity_, Tolerance_ const &tolerance = kEpsilon_) final;
+  MOCK_METHOD(void, RemoveKnotsMock, (Dimension const &, Knots_ const &, Tolerance_ const &), ());
+  void RemoveKnots(Dimension const &dimension, Knots_ const &knots, Tolerance_ const &tolerance = kEpsilon_) final;
   MOCK_METHOD(ElevationInformation_, ElevateDegreeMock, (Dimension const &, Multiplicity const &, Tolerance_ const &),
               ());
   ElevationInformation_ ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity = kMultiplicity_,
@@ -71,6 +109,11 @@ class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2
                                      Tolerance_ const &tolerance = kEpsilon_) final;
 
   MOCK_METHOD(ParametricCoordinates_, Sample, (NumberOfParametricCoordinates_ const &), (const));
+  MOCK_METHOD(SampledNonZeroBasisFunctions_, SampleNonZeroBasisFunctionsMock, (NumberOfParametricCoordinates_ const &,
+                                                                               Tolerance_ const &), (const));
+  SampledNonZeroBasisFunctions_ SampleNonZeroBasisFunctions(
+      NumberOfParametricCoordinates_ const &number_of_parametric_coordinates, Tolerance_ const &tolerance = kEpsilon_)
+      const final;
   MOCK_METHOD(OutputInformation_, WriteMock, (Precision const &), (const));
   OutputInformation_ Write(Precision const &precision = kPrecision_) const final;
 
@@ -100,6 +143,7 @@ class A2dParameterSpaceMock : public sources::parameter_spaces::ParameterSpace<2
   void NurbsBookExe3_8InsertRemoveKnotVectorsDegreesBasisFunctions();
   void NurbsBookExe3_8KnotVectorsDegrees();
   void NurbsBookExe4_4KnotVectorsDegrees();
+  void CreateBSplineBases();
 };
 
 }  // namespace splinelib::tests::parameter_spaces
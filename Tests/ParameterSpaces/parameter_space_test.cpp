@@ -13,11 +13,13 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <cmath>
+#include <utility>
+
 #include <gtest/gtest.h>
 #include "Sources/ParameterSpaces/parameter_space.hpp"
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/numeric_operations.hpp"
-#include "Tests/ParameterSpaces/parameter_space_2d.hpp"
 #include "Tests/ParameterSpaces/knot_vector_mock.hpp"
 #include "Tests/ParameterSpaces/non_zero_degree_b_spline_basis_function_mock.hpp"
 #include "Tests/Utilities/index_mock.hpp"
@@ -69,17 +71,16 @@ class ParameterSpaceSuite : public testing::Test {
       kInsertionInformationSecond_{kIndex2_, {kKnotRatiosSecond_}}, kInsertionInformationTwice_{kIndex2_,
           {kKnotRatiosFirst_, kKnotRatiosSecond_}};
   inline static ParameterSpace_::KnotVectors_ const kKnotVectors_{mock_knot_vectors::NurbsBookExa2_2()};
-  inline static ParameterSpace2d const kParameterSpaceElevatedOnce_{mock_knot_vectors::NurbsBookExa2_2IncreasedOnce(),
-      Degrees_{Degree{3}, kDegree2_}, mock_b_spline_basis_functions::NurbsBookExa2_2ElevatedOnce()},
-          kParameterSpaceInserted_{mock_knot_vectors::NurbsBookExa2_2Inserted(), kDegrees_,
-              mock_b_spline_basis_functions::NurbsBookExa2_2Inserted()};
+  inline static ParameterSpace_ const kParameterSpaceElevatedOnce_{mock_knot_vectors::NurbsBookExa2_2IncreasedOnce(),
+      Degrees_{Degree{3}, kDegree2_}}, kParameterSpaceInserted_{mock_knot_vectors::NurbsBookExa2_2Inserted(),
+                                                                kDegrees_};
 
   ParameterSpaceSuite();
 
   StrictMock<ANonZeroDegreeBSplineBasisFunctionMock> basis_function0_, basis_function1_;
   Index_ basis_function1_0_;
   SharedPointer<KnotVector_> knot_vector_{make_shared<KnotVector_>()};
-  ParameterSpace2d parameter_space_{kKnotVectors_, kDegrees_, mock_b_spline_basis_functions::NurbsBookExa2_2()};
+  ParameterSpace_ parameter_space_{kKnotVectors_, kDegrees_};
 };
 
 ParameterSpaceSuite::ParameterSpaceSuite() {
@@ -89,11 +90,32 @@ ParameterSpaceSuite::ParameterSpaceSuite() {
   knot_vector_->NurbsBookExa2_1();
 }
 
-TEST_F(ParameterSpaceSuite, CopyConstructAndCopyAssignDependingOnCopyKnotVectorsAndRecreateBasisFunctions) {
+TEST_F(ParameterSpaceSuite, CopyConstructAndCopyAssignDependingOnCopyKnotVectorsAndCopyBasisFunctions) {
   EXPECT_NO_THROW(ParameterSpace_ parameter_space_copy_constructed(parameter_space_));
 
   ParameterSpace_ parameter_space_copy_assigned;
   EXPECT_NO_THROW(parameter_space_copy_assigned = parameter_space_);
+
+  ParameterSpace_ parameter_space_inserted;
+  ASSERT_NO_THROW(parameter_space_inserted = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  ASSERT_NO_THROW(parameter_space_inserted.InsertKnot(kDimension1_, k0_5_));
+  ParameterSpace_ const parameter_space_copy_constructed(parameter_space_inserted);
+  EXPECT_EQ(parameter_space_copy_constructed, kParameterSpaceInserted_);
+  ASSERT_NO_THROW(parameter_space_copy_assigned = parameter_space_inserted);
+  EXPECT_EQ(parameter_space_copy_assigned, kParameterSpaceInserted_);
+}
+
+TEST_F(ParameterSpaceSuite, MoveConstructAndMoveAssignDependingOnMoveBasisFunctions) {
+  using std::move;
+
+  ParameterSpace_ parameter_space_inserted;
+  ASSERT_NO_THROW(parameter_space_inserted = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  ASSERT_NO_THROW(parameter_space_inserted.InsertKnot(kDimension1_, k0_5_));
+  ParameterSpace_ parameter_space_move_constructed(move(parameter_space_inserted));
+  EXPECT_EQ(parameter_space_move_constructed, kParameterSpaceInserted_);
+  ParameterSpace_ parameter_space_move_assigned;
+  ASSERT_NO_THROW(parameter_space_move_assigned = move(parameter_space_move_constructed));
+  EXPECT_EQ(parameter_space_move_assigned, kParameterSpaceInserted_);
 }
 
 TEST_F(ParameterSpaceSuite, IsEqualAndOperatorEqual) {
@@ -108,8 +130,6 @@ TEST_F(ParameterSpaceSuite, IsEqualAndOperatorEqual) {
   knot_vector->NurbsBookExa2_2Perturbed();
   ParameterSpace_ parameter_space_knot_vector;
   ASSERT_NO_THROW(parameter_space_knot_vector = ParameterSpace_({knot_vector, knot_vector_}, kDegrees_, kTolerance));
-//  ASSERT_NO_THROW(parameter_space_knot_vector = ParameterSpace2d({knot_vector, knot_vector_}, kDegrees_,
-//                                                    mock_b_spline_basis_functions::NurbsBookExe2_2Perturbed()));
   EXPECT_FALSE(IsEqual(parameter_space_knot_vector, parameter_space_));
   EXPECT_FALSE(parameter_space_knot_vector == parameter_space_);
   EXPECT_TRUE(IsEqual(parameter_space_knot_vector, parameter_space_, kTolerance));
@@ -142,6 +162,21 @@ TEST_F(ParameterSpaceSuite, DetermineBezierExtractionKnots) {
                                                                                 {k1_0_, Knot_{2.0}, Knot_{3.0}}}));
 }
 
+TEST_F(ParameterSpaceSuite, DetermineBezierExtractionOperators) {
+  using BezierExtractionOperators = ParameterSpace_::BezierExtractionOperators_;
+  using ExtractionOperatorRow = ParameterSpace_::BezierExtractionOperator_::value_type;
+
+  constexpr ParameterSpace_::Type_ const k0_0{}, k1_0{1.0};
+  ExtractionOperatorRow const kRow0{k1_0, k0_0, k0_0}, kRow1{k0_0, k1_0, k0_0}, kRow2{k0_0, k0_0, k1_0},
+                              kRowHalf0{kOneHalf_, k0_0, k0_0}, kRowHalf2{k0_0, k0_0, kOneHalf_};
+  EXPECT_EQ(parameter_space_.DetermineBezierExtractionOperators(kDimension0_), (BezierExtractionOperators{{Index{},
+                {kRow0, {k0_0, k1_0, kOneHalf_}, kRowHalf2}}, {Index{1}, {kRowHalf0, {kOneHalf_, k1_0, kOneHalf_},
+                    kRowHalf2}}, {kIndex2_, {kRowHalf0, {kOneHalf_, k1_0, kOneHalf_}, kRowHalf2}}, {Index{3},
+                        {kRowHalf0, {kOneHalf_, k1_0, k0_0}, kRow2}}, {Index{5}, {kRow0, kRow1, kRow2}}}));
+  EXPECT_EQ(parameter_space_.DetermineBezierExtractionOperators(kDimension1_), (BezierExtractionOperators{{Index{},
+                {kRow0, kRow1, kRow2}}}));
+}
+
 TEST_F(ParameterSpaceSuite, EvaluateBasisFunction) {
   EXPECT_TRUE(IsEqual(parameter_space_.EvaluateBasisFunction(basis_function1_0_, kParametricCoordinate_),
                       basis_function1_(k1_0_) * basis_function0_(k0_5_)));
@@ -155,27 +190,189 @@ TEST_F(ParameterSpaceSuite, EvaluateBasisFunctionDerivative) {
                                                                                          kParametricCoordinate_)));
 }
 
-TEST_F(ParameterSpaceSuite, InsertKnotDependingOnDetermineInsertionInformationAndRecreateBasisFunctions) {
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionsDependingOnGetNumberOfBasisFunctions) {
+  using Type = ParameterSpace_::Type_;
+
+  constexpr Type const k0_0{}, k0_25{0.25}, k0_5{0.5};
+
+  auto const &[first_non_zero_basis_function, basis_function_values] =
+      parameter_space_.EvaluateNonZeroBasisFunctions(kParametricCoordinate_);
+  EXPECT_EQ(first_non_zero_basis_function, basis_function1_0_);
+  EXPECT_EQ(basis_function_values, (ParameterSpace_::BasisFunctionValues_{{{k0_5, k0_5, k0_0}, {k0_25, k0_5,
+                                                                                                  k0_25}}}));
+  ParameterSpace_::KnotSpans_ knot_spans{};
+  EXPECT_EQ(parameter_space_.EvaluateNonZeroBasisFunctions(kParametricCoordinate_, knot_spans),
+            parameter_space_.EvaluateNonZeroBasisFunctions(kParametricCoordinate_));
+  EXPECT_EQ(knot_spans, (ParameterSpace_::KnotSpans_{KnotSpan{3}, KnotSpan{2}}));
+}
+
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionsForSpecializedAndGenericDegrees) {
+  using KnotVector = sources::parameter_spaces::KnotVector;
+  using ParameterSpace1d = ParameterSpace<1>;
+  using Index1d = ParameterSpace1d::Index_;
+
+  constexpr ParametricCoordinate const kParametricCoordinate{0.3};
+
+  for (int degree{1}; degree <= 7; ++degree) {
+    KnotVector::Knots_ knots(degree + 1, k0_0_);
+    knots.insert(knots.end(), {Knot_{0.25}, k0_5_, Knot_{0.75}});
+    knots.insert(knots.end(), degree + 1, k1_0_);
+    ParameterSpace1d const parameter_space{{make_shared<KnotVector>(knots)}, {Degree{degree}}};
+    auto const &[first_non_zero_basis_function, basis_function_values] =
+        parameter_space.EvaluateNonZeroBasisFunctions({kParametricCoordinate});
+    ASSERT_EQ(static_cast<int>(basis_function_values[0].size()), degree + 1);
+    for (int basis_function{}; basis_function <= degree; ++basis_function)
+        EXPECT_NEAR(basis_function_values[0][basis_function], parameter_space.EvaluateBasisFunction(Index1d{
+                        parameter_space.GetNumberOfBasisFunctions(), {Index{first_non_zero_basis_function[
+                            Dimension{}].Get() + basis_function}}}, {kParametricCoordinate}), kEpsilon_);
+  }
+}
+
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionsOfUniformKnotVectors) {
+  using KnotVector = sources::parameter_spaces::KnotVector;
+  using ParameterSpace1d = ParameterSpace<1>;
+  using Index1d = ParameterSpace1d::Index_;
+
+  constexpr int const kNumberOfKnotSpans{8};
+
+  for (int degree{1}; degree <= 6; ++degree) {
+    KnotVector::Knots_ knots(degree, k0_0_);
+    for (int knot{}; knot <= kNumberOfKnotSpans; ++knot)
+        knots.emplace_back(static_cast<double>(knot) / kNumberOfKnotSpans);
+    knots.insert(knots.end(), degree, k1_0_);
+    ParameterSpace1d const parameter_space{{make_shared<KnotVector>(knots)}, {Degree{degree}}};
+    for (ParametricCoordinate const &parametric_coordinate : {k0_0_, ParametricCoordinate{0.3}, k0_5_,
+             ParametricCoordinate{0.55}, ParametricCoordinate{0.9}, k1_0_}) {
+      auto const &[first_non_zero_basis_function, basis_function_values] =
+          parameter_space.EvaluateNonZeroBasisFunctions({parametric_coordinate});
+      ASSERT_EQ(static_cast<int>(basis_function_values[0].size()), degree + 1);
+      for (int basis_function{}; basis_function <= degree; ++basis_function)
+          EXPECT_NEAR(basis_function_values[0][basis_function], parameter_space.EvaluateBasisFunction(Index1d{
+                          parameter_space.GetNumberOfBasisFunctions(), {Index{first_non_zero_basis_function[
+                              Dimension{}].Get() + basis_function}}}, {parametric_coordinate}), kEpsilon_);
+    }
+  }
+}
+
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionsForLanesOfUniformAndNonUniformKnotVectors) {
+  using KnotVector = sources::parameter_spaces::KnotVector;
+  using ParameterSpace1d = ParameterSpace<1>;
+  using ParametricCoordinate1d = ParameterSpace1d::ParametricCoordinate_;
+
+  constexpr int const kNumberOfKnotSpans{4}, kNumberOfLanes{3};
+
+  for (bool const is_uniform : {true, false}) {
+    for (int degree{1}; degree <= 7; ++degree) {
+      KnotVector::Knots_ knots(degree + 1, k0_0_);
+      for (int knot{1}; knot < kNumberOfKnotSpans; ++knot)
+          knots.emplace_back(is_uniform ? (static_cast<double>(knot) / kNumberOfKnotSpans) : (0.2 * knot + 0.01));
+      knots.insert(knots.end(), degree + 1, k1_0_);
+      ParameterSpace1d const parameter_space{{make_shared<KnotVector>(knots)}, {Degree{degree}}};
+      Vector<ParametricCoordinate1d> const parametric_coordinates{{ParametricCoordinate{0.26}},
+          {ParametricCoordinate{0.3}}, {ParametricCoordinate{0.38}}};
+      Vector<ParameterSpace1d::KnotSpans_> knot_spans(kNumberOfLanes);
+      parameter_space.FindKnotSpans(parametric_coordinates, knot_spans);
+      ParameterSpace1d::LaneMajorValues_ lanes{}, values{};
+      for (ParametricCoordinate1d const &parametric_coordinate : parametric_coordinates) {
+        EXPECT_EQ(knot_spans[static_cast<int>(lanes[0].size())], knot_spans[0]);
+        lanes[0].emplace_back(parametric_coordinate[0].Get());
+      }
+      parameter_space.EvaluateNonZeroBasisFunctions(lanes, knot_spans[0], values);
+      ASSERT_EQ(static_cast<int>(values[0].size()), (degree + 1) * kNumberOfLanes);
+      for (int lane{}; lane < kNumberOfLanes; ++lane) {
+        auto const &[first_non_zero_basis_function, basis_function_values] =
+            parameter_space.EvaluateNonZeroBasisFunctions(parametric_coordinates[lane]);
+        EXPECT_EQ(first_non_zero_basis_function[Dimension{}].Get(), knot_spans[lane][0].Get() - degree);
+        for (int basis_function{}; basis_function <= degree; ++basis_function)
+            EXPECT_NEAR(values[0][basis_function * kNumberOfLanes + lane], basis_function_values[0][basis_function],
+                        kEpsilon_);
+      }
+    }
+  }
+}
+
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionDerivativesForSpecializedAndGenericDegrees) {
+  using KnotVector = sources::parameter_spaces::KnotVector;
+  using ParameterSpace1d = ParameterSpace<1>;
+  using Index1d = ParameterSpace1d::Index_;
+
+  constexpr ParametricCoordinate const kParametricCoordinate{0.3};
+
+  // The workspace is reused for all degrees, i.e., both for fixed-size and dynamically allocated derivatives.
+  ParameterSpace1d::DerivativesWorkspace_ workspace;
+  for (int degree{1}; degree <= 7; ++degree) {
+    KnotVector::Knots_ knots(degree + 1, k0_0_);
+    knots.insert(knots.end(), {Knot_{0.25}, k0_5_, Knot_{0.75}});
+    knots.insert(knots.end(), degree + 1, k1_0_);
+    ParameterSpace1d const parameter_space{{make_shared<KnotVector>(knots)}, {Degree{degree}}};
+    auto const &[first_non_zero_basis_function, basis_function_derivatives] =
+        parameter_space.EvaluateNonZeroBasisFunctionDerivatives({kParametricCoordinate}, {Derivative{degree + 1}});
+    ASSERT_EQ(static_cast<int>(basis_function_derivatives[0].size()), degree + 2);
+    ASSERT_NO_THROW(parameter_space.EvaluateNonZeroBasisFunctionDerivatives({kParametricCoordinate},
+                                                                            {Derivative{degree + 1}}, workspace));
+    EXPECT_EQ(workspace.GetFirstNonZeroBasisFunction(), first_non_zero_basis_function);
+    EXPECT_TRUE(workspace.GetDerivatives(Dimension{}, Derivative{degree + 1}).empty());
+    for (int derivative{}; derivative <= (degree + 1); ++derivative) {
+      Span<ParameterSpace1d::Type_ const> const &stored_derivatives = workspace.GetDerivatives(Dimension{},
+                                                                                               Derivative{derivative});
+      for (int basis_function{}; basis_function <= degree; ++basis_function) {
+        ParameterSpace1d::Type_ const &expected_derivative = parameter_space.EvaluateBasisFunctionDerivative(Index1d{
+            parameter_space.GetNumberOfBasisFunctions(), {Index{first_non_zero_basis_function[Dimension{}].Get() +
+                basis_function}}}, {kParametricCoordinate}, {Derivative{derivative}});
+        EXPECT_NEAR(basis_function_derivatives[0][derivative][basis_function], expected_derivative,
+                    kEpsilon_ * (1.0 + std::abs(expected_derivative)));
+        if (derivative <= degree) {
+          EXPECT_NEAR(stored_derivatives[basis_function], expected_derivative,
+                      kEpsilon_ * (1.0 + std::abs(expected_derivative)));
+        }
+      }
+    }
+  }
+}
+
+TEST_F(ParameterSpaceSuite, EvaluateNonZeroBasisFunctionDerivativesDependingOnGetNumberOfBasisFunctions) {
+  using Type = ParameterSpace_::Type_;
+
+  constexpr Type const k0_0{}, k0_25{0.25}, k0_5{0.5}, k1_0{1.0};
+
+  auto const &[first_non_zero_basis_function, basis_function_derivatives] =
+      parameter_space_.EvaluateNonZeroBasisFunctionDerivatives(kParametricCoordinate_, {Derivative{2}, kDerivative1_});
+  EXPECT_EQ(first_non_zero_basis_function, basis_function1_0_);
+  EXPECT_EQ(basis_function_derivatives, (ParameterSpace_::BasisFunctionDerivatives_{{{{k0_5, k0_5, k0_0}, {-k1_0,
+      k1_0, k0_0}, {k1_0, Type{-2.0}, k1_0}}, {{k0_25, k0_5, k0_25}, {-k1_0, k0_0, k1_0}}}}));
+  ParameterSpace_::KnotSpans_ knot_spans{};
+  EXPECT_EQ(parameter_space_.EvaluateNonZeroBasisFunctionDerivatives(kParametricCoordinate_, kDerivative_, knot_spans),
+            parameter_space_.EvaluateNonZeroBasisFunctionDerivatives(kParametricCoordinate_, kDerivative_));
+  EXPECT_EQ(knot_spans, (ParameterSpace_::KnotSpans_{KnotSpan{3}, KnotSpan{2}}));
+}
+
+TEST_F(ParameterSpaceSuite, InsertKnotDependingOnDetermineInsertionInformationAndInvalidateBasisFunctions) {
   ParameterSpace_ parameter_space_insert, parameter_space_subdivide;
-  ASSERT_NO_THROW(parameter_space_insert = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_,
-                                                            mock_b_spline_basis_functions::NurbsBookExa2_2()));
-  ASSERT_NO_THROW(parameter_space_subdivide = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_,
-                                                               mock_b_spline_basis_functions::NurbsBookExa2_2()));
+  ASSERT_NO_THROW(parameter_space_insert = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  ASSERT_NO_THROW(parameter_space_subdivide = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
   EXPECT_EQ(parameter_space_insert.InsertKnot(kDimension1_, k0_5_), kInsertionInformationFirst_);
   EXPECT_EQ(parameter_space_insert, kParameterSpaceInserted_);
   EXPECT_EQ(parameter_space_subdivide.InsertKnot(kDimension1_, k0_5_, kMultiplicity2_), kInsertionInformationTwice_);
-  EXPECT_EQ(parameter_space_subdivide, ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_,
-                                                        mock_b_spline_basis_functions::NurbsBookExa2_2Subdivided()));
+  EXPECT_EQ(parameter_space_subdivide, ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
   EXPECT_EQ(parameter_space_insert.InsertKnot(kDimension1_, k0_5_), kInsertionInformationSecond_);
   EXPECT_EQ(parameter_space_insert, parameter_space_subdivide);
 }
 
-TEST_F(ParameterSpaceSuite, RemoveKnotDependingOnDetermineInsertionInformationAndRecreateBasisFunctions) {
+TEST_F(ParameterSpaceSuite, RefineKnotsDependingOnInvalidateBasisFunctions) {
+  ParameterSpace_ parameter_space_refine;
+  ASSERT_NO_THROW(parameter_space_refine = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  auto const &[knot_vector, inserted_knots] = parameter_space_refine.RefineKnots(kDimension1_, {k0_5_, k0_5_});
+  EXPECT_EQ(knot_vector, *mock_knot_vectors::NurbsBookExa2_2()[1]);
+  EXPECT_EQ(inserted_knots, (ParameterSpace_::Knots_{k0_5_, k0_5_}));
+  EXPECT_EQ(parameter_space_refine, ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
+  EXPECT_TRUE(std::get<1>(parameter_space_refine.RefineKnots(kDimension1_, {k0_5_})).empty());
+  EXPECT_EQ(parameter_space_refine, ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
+}
+
+TEST_F(ParameterSpaceSuite, RemoveKnotDependingOnDetermineInsertionInformationAndInvalidateBasisFunctions) {
   ParameterSpace_ parameter_space_remove, parameter_space_erase;
-  ASSERT_NO_THROW(parameter_space_remove = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_,
-                                                            mock_b_spline_basis_functions::Empty()));
-  ASSERT_NO_THROW(parameter_space_erase = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_,
-                                                           mock_b_spline_basis_functions::Empty()));
+  ASSERT_NO_THROW(parameter_space_remove = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
+  ASSERT_NO_THROW(parameter_space_erase = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
   EXPECT_EQ(parameter_space_remove.RemoveKnot(kDimension1_, k0_5_), kInsertionInformationSecond_);
   EXPECT_EQ(parameter_space_remove, kParameterSpaceInserted_);
   EXPECT_EQ(parameter_space_erase.RemoveKnot(kDimension1_, k0_5_, kMultiplicity2_), kInsertionInformationTwice_);
@@ -186,35 +383,37 @@ TEST_F(ParameterSpaceSuite, RemoveKnotDependingOnDetermineInsertionInformationAn
   EXPECT_EQ(parameter_space_remove, parameter_space_);
 }
 
-TEST_F(ParameterSpaceSuite, ElevateDegreeDependingOnRecreateBasisFunctions) {
+TEST_F(ParameterSpaceSuite, GetKnotVectorAndRemoveKnotsDependingOnInvalidateBasisFunctions) {
+  ParameterSpace_ parameter_space_remove;
+  ASSERT_NO_THROW(parameter_space_remove = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2Subdivided(), kDegrees_));
+  EXPECT_EQ(parameter_space_remove.GetKnotVector(kDimension1_), *mock_knot_vectors::NurbsBookExa2_2Subdivided()[1]);
+  EXPECT_NO_THROW(parameter_space_remove.RemoveKnots(kDimension1_, {k0_5_}));
+  EXPECT_EQ(parameter_space_remove, kParameterSpaceInserted_);
+  EXPECT_NO_THROW(parameter_space_remove.RemoveKnots(kDimension1_, {k0_5_, k0_5_}));
+  EXPECT_EQ(parameter_space_remove, parameter_space_);
+}
+
+TEST_F(ParameterSpaceSuite, ElevateDegreeDependingOnInvalidateBasisFunctions) {
   ParameterSpace_ parameter_space_elevate_once, parameter_space_elevate_twice;
-  ASSERT_NO_THROW(parameter_space_elevate_once = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_,
-                                                                  mock_b_spline_basis_functions::NurbsBookExa2_2()));
-  ASSERT_NO_THROW(parameter_space_elevate_twice = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_,
-                                                                   mock_b_spline_basis_functions::NurbsBookExa2_2()));
+  ASSERT_NO_THROW(parameter_space_elevate_once = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  ASSERT_NO_THROW(parameter_space_elevate_twice = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
   EXPECT_EQ(parameter_space_elevate_once.ElevateDegree(kDimension0_), kElevationInformationFirst_);
   EXPECT_EQ(parameter_space_elevate_once, kParameterSpaceElevatedOnce_);
   EXPECT_EQ(parameter_space_elevate_twice.ElevateDegree(kDimension0_, kMultiplicity2_), kElevationInformationTwice_);
   EXPECT_EQ(parameter_space_elevate_twice, ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
                                                            kDegreesElevatedTwice_));
-//  EXPECT_EQ(parameter_space_elevate_twice, ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
-//                kDegreesElevatedTwice_, mock_b_spline_basis_functions::NurbsBookExa2_2ElevatedTwice()));
   EXPECT_EQ(parameter_space_elevate_once.ElevateDegree(kDimension0_), kElevationInformationSecond_);
   EXPECT_EQ(parameter_space_elevate_once, parameter_space_elevate_twice);
 }
 
-TEST_F(ParameterSpaceSuite, ReduceDegreeDependingOnRecreateBasisFunctions) {
+TEST_F(ParameterSpaceSuite, ReduceDegreeDependingOnInvalidateBasisFunctions) {
   constexpr Degree const kDegree1{1};
 
   ParameterSpace_ parameter_space_reduce_once, parameter_space_reduce_twice;
   ASSERT_NO_THROW(parameter_space_reduce_once = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
                                                                 kDegreesElevatedTwice_));
-//  ASSERT_NO_THROW(parameter_space_reduce_once = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
-//                      kDegreesElevatedTwice_, mock_b_spline_basis_functions::NurbsBookExa2_2ElevatedTwice()));
   ASSERT_NO_THROW(parameter_space_reduce_twice = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
                                                                  kDegreesElevatedTwice_));
-//  ASSERT_NO_THROW(parameter_space_reduce_twice = ParameterSpace2d(mock_knot_vectors::NurbsBookExa2_2IncreasedTwice(),
-//                      kDegreesElevatedTwice_, mock_b_spline_basis_functions::NurbsBookExa2_2ElevatedTwice()));
   EXPECT_EQ(parameter_space_reduce_once.ReduceDegree(kDimension0_), kElevationInformationSecond_);
   EXPECT_EQ(parameter_space_reduce_once, kParameterSpaceElevatedOnce_);
   EXPECT_EQ(parameter_space_reduce_twice.ReduceDegree(kDimension0_, kMultiplicity2_), kElevationInformationTwice_);
@@ -225,6 +424,32 @@ TEST_F(ParameterSpaceSuite, ReduceDegreeDependingOnRecreateBasisFunctions) {
                 kDegree1}).ReduceDegree(kDimension0_), (ElevationInformation_{Index{kDegree1.Get()}, {}}));
 }
 
+TEST_F(ParameterSpaceSuite, CommitAndRollbackTransactions) {
+  ParameterSpace_ parameter_space;
+  ASSERT_NO_THROW(parameter_space = ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2(), kDegrees_));
+  parameter_space.BeginTransaction();
+  parameter_space.InsertKnot(kDimension1_, k0_5_, kMultiplicity2_);
+  parameter_space.RemoveKnot(kDimension1_, k0_5_);
+  parameter_space.BeginTransaction();
+  parameter_space.ElevateDegree(kDimension0_);
+  parameter_space.RemoveKnots(kDimension1_, {k0_5_});
+  ASSERT_NO_THROW(parameter_space.CommitTransaction());
+  EXPECT_EQ(parameter_space, ParameterSpace_(mock_knot_vectors::NurbsBookExa2_2IncreasedOnce(),
+                                             Degrees_{Degree{3}, kDegree2_}));
+  ASSERT_NO_THROW(parameter_space.RollbackTransaction());
+  EXPECT_EQ(parameter_space, parameter_space_);
+
+  parameter_space.BeginTransaction();
+  parameter_space.RefineKnots(kDimension1_, {k0_5_});
+  parameter_space.BeginTransaction();
+  parameter_space.ElevateDegree(kDimension0_, kMultiplicity2_);
+  parameter_space.ReduceDegree(kDimension0_);
+  ASSERT_NO_THROW(parameter_space.RollbackTransaction());
+  EXPECT_EQ(parameter_space, kParameterSpaceInserted_);
+  ASSERT_NO_THROW(parameter_space.CommitTransaction());
+  EXPECT_EQ(parameter_space, kParameterSpaceInserted_);
+}
+
 TEST_F(ParameterSpaceSuite, Sample) {
   constexpr ParametricCoordinate const k2_5{2.5};
 
@@ -232,6 +457,17 @@ TEST_F(ParameterSpaceSuite, Sample) {
                 {k2_5, k0_0_}, {k5_0_, k0_0_}, {k0_0_, k1_0_}, {k2_5, k1_0_}, {k5_0_, k1_0_}}));
 }
 
+TEST_F(ParameterSpaceSuite, SampleNonZeroBasisFunctions) {
+  using Type = ParameterSpace_::Type_;
+
+  constexpr Type const k0_0{}, k1_0{1.0};
+  constexpr Index const kIndex0{};
+
+  EXPECT_EQ(parameter_space_.SampleNonZeroBasisFunctions({Length{2}, Length{2}}),
+            (ParameterSpace_::SampledNonZeroBasisFunctions_{{{{kIndex0, {k1_0, k0_0, k0_0}}, {Index{5}, {k0_0, k0_0,
+                 k1_0}}}, {{kIndex0, {k1_0, k0_0, k0_0}}, {kIndex0, {k0_0, k0_0, k1_0}}}}}));
+}
+
 TEST_F(ParameterSpaceSuite, WriteDependingOnGetNumberOfBasisFunctions) {
   using OutputInformation = ParameterSpace_::OutputInformation_;
   using std::tuple_element_t;
@@ -253,6 +489,7 @@ TEST_F(ParameterSpaceSuite, ThrowIfKnotVectorsAreNotClamped) {
   EXPECT_THROW(ParameterSpace_(kKnotVectors_, Degrees_{Degree{}, kDegree2_}), DomainError);
   EXPECT_THROW(parameter_space_.InsertKnot(kDimension0_, k0_0_), DomainError);
   EXPECT_THROW(parameter_space_.RemoveKnot(kDimension0_, k5_0_), DomainError);
+  EXPECT_THROW(parameter_space_.RemoveKnots(kDimension0_, {k0_0_}), DomainError);
 }
 
 TEST_F(ParameterSpaceSuite, ThrowIfDimensionIsInvalid) {
@@ -260,6 +497,8 @@ TEST_F(ParameterSpaceSuite, ThrowIfDimensionIsInvalid) {
 
   EXPECT_THROW(parameter_space_.InsertKnot(kDimension2, k0_5_), OutOfRange);
   EXPECT_THROW(parameter_space_.RemoveKnot(kDimension2, k0_5_), OutOfRange);
+  EXPECT_THROW(parameter_space_.GetKnotVector(kDimension2), OutOfRange);
+  EXPECT_THROW(parameter_space_.RemoveKnots(kDimension2, {k0_5_}), OutOfRange);
   EXPECT_THROW(parameter_space_.ElevateDegree(kDimension2), OutOfRange);
   EXPECT_THROW(parameter_space_.ReduceDegree(kDimension2), OutOfRange);
 }
@@ -49,14 +49,29 @@ Coordinate3d A2d3dBSplineMock::operator()(ParametricCoordinate_ const &parametri
   return Evaluate(parametric_coordinate, tolerance);
 }
 
+Coordinate3d A2d3dBSplineMock::operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &,
+                                          Tolerance const &tolerance) const {
+  return Evaluate(parametric_coordinate, tolerance);
+}
+
 Coordinate3d A2d3dBSplineMock::operator()(ParametricCoordinate_ const &parametric_coordinate,
                                           Derivative_ const &derivative, Tolerance const &tolerance) const {
   return EvaluateDerivative(parametric_coordinate, derivative, tolerance);
 }
 
+A2d3dBSplineMock::Coordinates_ A2d3dBSplineMock::EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+    Derivative_ const &maximum_derivative, Tolerance const &tolerance) const {
+  return Base_::EvaluateDerivatives(parametric_coordinate, maximum_derivative, tolerance);
+}
+
+void A2d3dBSplineMock::Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                               Tolerance const &tolerance) const {
+  Base_::Evaluate(parametric_coordinates, coordinates, tolerance);
+}
+
 A2d3dBSplineMock::Coordinates_
 A2d3dBSplineMock::Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
-                         Tolerance const &tolerance) const {
+                         NumberOfThreads const &, Tolerance const &tolerance) const {
   return SampleMock(number_of_parametric_coordinates, tolerance);
 }
 
@@ -112,21 +127,52 @@ Coordinate4d A2d4dBSplineMock::operator()(ParametricCoordinate_ const &parametri
   return Evaluate(parametric_coordinate, tolerance);
 }
 
+Coordinate4d A2d4dBSplineMock::operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &,
+                                          Tolerance const &tolerance) const {
+  return Evaluate(parametric_coordinate, tolerance);
+}
+
 Coordinate4d A2d4dBSplineMock::operator()(ParametricCoordinate_ const &parametric_coordinate,
                                           Derivative_ const &derivative, Tolerance const &tolerance) const {
   return EvaluateDerivative(parametric_coordinate, derivative, tolerance);
 }
 
+A2d4dBSplineMock::Coordinates_ A2d4dBSplineMock::EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+    Derivative_ const &maximum_derivative, Tolerance const &tolerance) const {
+  return Base_::EvaluateDerivatives(parametric_coordinate, maximum_derivative, tolerance);
+}
+
+void A2d4dBSplineMock::Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                               Tolerance const &tolerance) const {
+  Base_::Evaluate(parametric_coordinates, coordinates, tolerance);
+}
+
+A2d4dBSplineMock::Coordinates_
+A2d4dBSplineMock::Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
+                         NumberOfThreads const &number_of_threads, Tolerance const &tolerance) const {
+  return Base_::Sample(number_of_parametric_coordinates, number_of_threads, tolerance);
+}
+
 void A2d4dBSplineMock::InsertKnot(Dimension const &dimension, Knot_ knot, Multiplicity const &multiplicity,
                                   Tolerance const &tolerance) const {
   InsertKnotMock(dimension, move(knot), multiplicity, tolerance);
 }
 
+void A2d4dBSplineMock::RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity,
+                                   Tolerance const &tolerance) const {
+  Base_::RefineKnots(dimension, move(knots), multiplicity, tolerance);
+}
+
 Multiplicity A2d4dBSplineMock::RemoveKnot(Dimension const &dimension, Knot_ const &knot,
     Tolerance const &tolerance_removal, Multiplicity const &multiplicity, Tolerance const &tolerance) const {
   return RemoveKnotMock(dimension, knot, tolerance_removal, multiplicity, tolerance);
 }
 
+A2d4dBSplineMock::Knots_ A2d4dBSplineMock::RemoveKnots(Dimension const &dimension, Tolerance const &tolerance_removal,
+                                                       Tolerance const &tolerance) const {
+  return RemoveKnotsMock(dimension, tolerance_removal, tolerance);
+}
+
 void A2d4dBSplineMock::ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity,
                                      Tolerance const &tolerance) const {
   ElevateDegreeMock(dimension, multiplicity, tolerance);
@@ -195,6 +241,8 @@ void A2d4dBSplineMock::NurbsBookExe4_4() {
   EXPECT_CALL(*this, InsertKnotMock(kDimension0, kParametricCoordinate0_5, kMultiplicity_, Ge(0.0))).Times(AtMost(1));
   EXPECT_CALL(*this, RemoveKnotMock(kDimension0, kParametricCoordinate0_5, kEpsilon * (1.0 / (1.0 + std::sqrt(13.0))),
                                     kMultiplicity_, Ge(0.0))).Times(AtMost(1)).WillRepeatedly(Return(Multiplicity{}));
+  EXPECT_CALL(*this, RemoveKnotsMock(kDimension0, kEpsilon * (1.0 / (1.0 + std::sqrt(13.0))), Ge(0.0)))
+      .Times(AtMost(1)).WillRepeatedly(Return(Knots_{}));
   EXPECT_CALL(*this, ElevateDegreeMock(kDimension0, kMultiplicity_, Ge(0.0))).Times(AtMost(1));
   EXPECT_CALL(*this, ReduceDegreeMock(kDimension0, Ge(0.0), kMultiplicity_, Ge(0.0))).WillRepeatedly(Return(false));
 }
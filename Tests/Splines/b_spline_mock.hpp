@@ -25,19 +25,29 @@ namespace splinelib::tests::splines {
 using sources::splines::BSpline, sources::splines::Tolerance;
 
 constexpr static Tolerance const &kEpsilon = sources::splines::kEpsilon;
+constexpr static NumberOfThreads const &kNumberOfThreads = sources::splines::kNumberOfThreads;
 
 class A2d3dBSplineMock : public BSpline<2, 3> {
  public:
   MOCK_METHOD(Coordinate_, Evaluate, (ParametricCoordinate_ const &, Tolerance const &), (const));
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Tolerance const &tolerance = kEpsilon)
       const final;
+  // Ignores the evaluation context (see Spline::operator()).
+  Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &evaluation_context,
+                         Tolerance const &tolerance = kEpsilon) const final;
   MOCK_METHOD(Coordinate_, EvaluateDerivative, (ParametricCoordinate_ const &, Derivative_ const &, Tolerance const &),
               (const));
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
                          Tolerance const &tolerance = kEpsilon) const final;
+  // Evaluates the derivatives one by one (see Spline::EvaluateDerivatives).
+  Coordinates_ EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance const &tolerance = kEpsilon) const final;
+  // Evaluates the parametric coordinates one by one (see Spline::Evaluate).
+  void Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                Tolerance const &tolerance = kEpsilon) const final;
   MOCK_METHOD(Coordinates_, SampleMock, (NumberOfParametricCoordinates_ const &, Tolerance const &), (const));
   Coordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
-                      Tolerance const &tolerance = kEpsilon) const;
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon) const final;
 
   void NurbsBookExe4_4();  // See NURBS book Exe. 4.4.
   void SquareUnitSecondOrderMaximallySmooth();  // {0; 0; 0; 0.5; 1; 1; 1} & {0; 0; 0; 1; 1; 1} —> {[0; 1]^2; 0}
@@ -50,18 +60,36 @@ class A2d4dBSplineMock : public BSpline<2, 4> {
   MOCK_METHOD(Coordinate_, Evaluate, (ParametricCoordinate_ const &, Tolerance const &), (const));
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Tolerance const &tolerance = kEpsilon)
       const final;
+  // Ignores the evaluation context (see Spline::operator()).
+  Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, EvaluationContext_ &evaluation_context,
+                         Tolerance const &tolerance = kEpsilon) const final;
   MOCK_METHOD(Coordinate_, EvaluateDerivative, (ParametricCoordinate_ const &, Derivative_ const &, Tolerance const &),
               (const));
   Coordinate_ operator()(ParametricCoordinate_ const &parametric_coordinate, Derivative_ const &derivative,
                          Tolerance const &tolerance = kEpsilon) const final;
+  // Evaluates the derivatives one by one (see Spline::EvaluateDerivatives).
+  Coordinates_ EvaluateDerivatives(ParametricCoordinate_ const &parametric_coordinate,
+      Derivative_ const &maximum_derivative, Tolerance const &tolerance = kEpsilon) const final;
+  // Evaluates the parametric coordinates one by one (see Spline::Evaluate).
+  void Evaluate(Span<ParametricCoordinate_ const> parametric_coordinates, Span<Coordinate_> coordinates,
+                Tolerance const &tolerance = kEpsilon) const final;
+  // Samples the parametric coordinates one by one (see Spline::Sample).
+  Coordinates_ Sample(NumberOfParametricCoordinates_ const &number_of_parametric_coordinates,
+      NumberOfThreads const &number_of_threads = kNumberOfThreads, Tolerance const &tolerance = kEpsilon) const final;
 
   MOCK_METHOD(void, InsertKnotMock, (Dimension const &, Knot_, Multiplicity const &, Tolerance const &), (const));
   void InsertKnot(Dimension const &dimension, Knot_ knot, Multiplicity const &multiplicity = kMultiplicity_,
                   Tolerance const &tolerance = kEpsilon) const final;
+  // Refines knot by knot (see Spline::RefineKnots).
+  void RefineKnots(Dimension const &dimension, Knots_ knots, Multiplicity const &multiplicity = kMultiplicity_,
+                   Tolerance const &tolerance = kEpsilon) const final;
   MOCK_METHOD(Multiplicity, RemoveKnotMock, (Dimension const &, Knot_ const &, Tolerance const &, Multiplicity const &,
                                              Tolerance const &), (const));
   Multiplicity RemoveKnot(Dimension const &dimension, Knot_ const &knot, Tolerance const &tolerance_removal,
       Multiplicity const &multiplicity = kMultiplicity_, Tolerance const &tolerance = kEpsilon) const final;
+  MOCK_METHOD(Knots_, RemoveKnotsMock, (Dimension const &, Tolerance const &, Tolerance const &), (const));
+  Knots_ RemoveKnots(Dimension const &dimension, Tolerance const &tolerance_removal,
+                     Tolerance const &tolerance = kEpsilon) const final;
   MOCK_METHOD(void, ElevateDegreeMock, (Dimension const &, Multiplicity const &, Tolerance const &), (const));
   void ElevateDegree(Dimension const &dimension, Multiplicity const &multiplicity = kMultiplicity_,
                      Tolerance const &tolerance = kEpsilon) const final;
@@ -100,6 +100,8 @@ TEST_F(BSplineSuite, IsEqualAndOperatorEqual) {
 
 // See NURBS book P3.20.
 TEST_F(BSplineSuite, Evaluate) {
+  using sources::vector_spaces::Layout;
+
   constexpr Coordinate const kCoordinate9_0{9.0};
   constexpr ParametricCoordinate const kParametricCoordinate1_0{1.0};
 
@@ -109,6 +111,28 @@ TEST_F(BSplineSuite, Evaluate) {
   EXPECT_EQ(b_spline_({kParametricCoordinate1_0, kParametricCoordinate1_0}),
             (Coordinate_{kCoordinate9_0, kCoordinate4_0_, kCoordinate0_0_}));
   EXPECT_EQ(b_spline_(kParametricCoordinate_), (Coordinate_{Coordinate{6.375}, kCoordinate2_0_, Coordinate{3.25}}));
+  BSpline_::EvaluationContext_ evaluation_context{};
+  EXPECT_EQ(b_spline_(kParametricCoordinate_, evaluation_context), b_spline_(kParametricCoordinate_));
+  EXPECT_EQ(b_spline_({kParametricCoordinate1_0, kParametricCoordinate1_0}, evaluation_context),
+            (Coordinate_{kCoordinate9_0, kCoordinate4_0_, kCoordinate0_0_}));
+
+  BSpline_::ParametricCoordinates_ const kParametricCoordinates{{kParametricCoordinate1_0, kParametricCoordinate0_0_},
+      {kParametricCoordinate0_0_, kParametricCoordinate1_0}, {kParametricCoordinate1_0, kParametricCoordinate1_0},
+          kParametricCoordinate_};
+  BSpline_::Coordinates_ coordinates(kParametricCoordinates.size());
+  ASSERT_NO_THROW(b_spline_.Evaluate(kParametricCoordinates, coordinates));
+  EXPECT_EQ(coordinates, (BSpline_::Coordinates_{{kCoordinate9_0, kCoordinate0_0_, kCoordinate0_0_}, kCoordinate8_,
+      {kCoordinate9_0, kCoordinate4_0_, kCoordinate0_0_}, b_spline_(kParametricCoordinate_)}));
+
+  BSpline_::Coordinates_ control_points, coordinates_depending_on_layout(kParametricCoordinates.size());
+  for (int control_point{}; control_point < 12; ++control_point)
+      control_points.emplace_back((*vector_space_)[Index{control_point}]);
+  for (Layout const &layout : {Layout::kStructureOfArrays, Layout::kBlocked}) {
+    BSpline_ const b_spline{parameter_space_, make_shared<sources::vector_spaces::VectorSpace<3>>(control_points,
+                                                                                                  layout)};
+    ASSERT_NO_THROW(b_spline.Evaluate(kParametricCoordinates, coordinates_depending_on_layout));
+    EXPECT_EQ(coordinates_depending_on_layout, coordinates);
+  }
 }
 
 // See NURBS book Eq. (3.24).
@@ -133,6 +157,22 @@ TEST_F(BSplineSuite, EvaluateDerivative) {
                                                                             kCoordinate0_0_}));
 }
 
+TEST_F(BSplineSuite, EvaluateDerivatives) {
+  constexpr Derivative const kDerivative1{1};
+
+  EXPECT_EQ(b_spline_.EvaluateDerivatives(kParametricCoordinate_, {kDerivative1, kDerivative1}),
+            (BSpline_::Coordinates_{b_spline_(kParametricCoordinate_), {Coordinate{15.0}, kCoordinate4_0_,
+                kCoordinate2_0_}, kCoordinate8_, {kCoordinate0_0_, Coordinate{8.0}, kCoordinate0_0_}}));
+
+  BSpline_::DerivativesWorkspace_ workspace;
+  BSpline_::Coordinates_ derivatives;
+  for (ParametricCoordinate_ const &parametric_coordinate : {kParametricCoordinate_, ParametricCoordinate_{}}) {
+    ASSERT_NO_THROW(b_spline_.EvaluateDerivatives(parametric_coordinate, {kDerivative1, kDerivative1}, workspace,
+                                                  derivatives));
+    EXPECT_EQ(derivatives, b_spline_.EvaluateDerivatives(parametric_coordinate, {kDerivative1, kDerivative1}));
+  }
+}
+
 TEST_F(BSplineSuite, InsertKnot) {
   SharedPointer<ParameterSpace_> parameter_space_insert{make_shared<ParameterSpace_>()},
                                  parameter_space_subdivide{make_shared<ParameterSpace_>()},
@@ -187,7 +227,18 @@ TEST_F(BSplineSuite, RemoveKnot) {
   EXPECT_EQ(b_spline_remove, b_spline_);
 }
 
-TEST_F(BSplineSuite, ElevateDegreeDependingOnMakeBezierAndMakeBSpline) {
+TEST_F(BSplineSuite, RemoveKnots) {
+  SharedPointer<ParameterSpace_> parameter_space{make_shared<ParameterSpace_>()};
+  parameter_space->NurbsBookExe3_8Subdivided();
+  SharedPointer<VectorSpace_> vector_space{make_shared<VectorSpace_>()};
+  vector_space->NurbsBookExe3_8Coarsen();
+  BSpline_ b_spline;
+  ASSERT_NO_THROW(b_spline = BSpline_(parameter_space, vector_space));
+  EXPECT_EQ(b_spline.RemoveKnots(kDimension1_, kEpsilon_), (BSpline_::Knots_{kKnot0_5_, kKnot0_5_}));
+  EXPECT_EQ(b_spline, b_spline_);
+}
+
+TEST_F(BSplineSuite, ElevateDegree) {
   SharedPointer<ParameterSpace_> parameter_space_elevate_once{make_shared<ParameterSpace_>()},
                                  parameter_space_elevate_twice{make_shared<ParameterSpace_>()},
                                  parameter_space_elevated_twice{make_shared<ParameterSpace_>()};
@@ -240,6 +291,27 @@ TEST_F(BSplineSuite, ComputeUpperBoundForMaximumDistanceFromOrigin) {
                       vector_space_->DetermineMaximumDistanceFromOrigin()));
 }
 
+TEST_F(BSplineSuite, ExtractBezierElements) {
+  using Coordinates = BSpline_::Coordinates_;
+
+  constexpr Coordinate const k0_0{}, k2_0{2.0}, k3_0{3.0}, k4_0{4.0}, k4_5{4.5}, k5_0{5.0}, k6_0{6.0}, k9_0{9.0};
+  constexpr Coordinate_ const kCoordinate0_0{k0_0, k0_0, k0_0}, kCoordinate1_0{k3_0, k0_0, k3_0}, kCoordinate2_0{k6_0,
+      k0_0, k3_0}, kCoordinate3_0{k9_0, k0_0, k0_0}, kCoordinate0_1{k0_0, k2_0, k2_0}, kCoordinate1_1{k3_0, k2_0, k5_0},
+      kCoordinate2_1{k6_0, k2_0, k5_0}, kCoordinate3_1{k9_0, k2_0, k2_0}, kCoordinate1_2{k3_0, k4_0, k3_0},
+      kCoordinate2_2{k6_0, k4_0, k3_0}, kCoordinate3_2{k9_0, k4_0, k0_0}, kCoordinateBezier2_0{k4_5, k0_0, k3_0},
+      kCoordinateBezier2_1{k4_5, k2_0, k5_0}, kCoordinateBezier2_2{k4_5, k4_0, k3_0};
+  // Elements [0.0, 0.5] x [0.0, 1.0] and [0.5, 1.0] x [0.0, 1.0].
+  Coordinates const kBezierElements{kCoordinate0_0, kCoordinate1_0, kCoordinateBezier2_0, kCoordinate0_1,
+      kCoordinate1_1, kCoordinateBezier2_1, kCoordinate8_, kCoordinate1_2, kCoordinateBezier2_2, kCoordinateBezier2_0,
+      kCoordinate2_0, kCoordinate3_0, kCoordinateBezier2_1, kCoordinate2_1, kCoordinate3_1, kCoordinateBezier2_2,
+      kCoordinate2_2, kCoordinate3_2};
+  EXPECT_EQ(b_spline_.ExtractBezierElements(kDimension0_), kBezierElements);
+  EXPECT_EQ(b_spline_.ExtractBezierElements(NumberOfThreads{2}), kBezierElements);
+  EXPECT_EQ(b_spline_.ExtractBezierElements(kDimension1_), (Coordinates{kCoordinate0_0, kCoordinate1_0,
+                kCoordinate2_0, kCoordinate3_0, kCoordinate0_1, kCoordinate1_1, kCoordinate2_1, kCoordinate3_1,
+                kCoordinate8_, kCoordinate1_2, kCoordinate2_2, kCoordinate3_2}));
+}
+
 TEST_F(BSplineSuite, Write) {
   EXPECT_EQ(b_spline_.Write(), (BSpline_::OutputInformation_{parameter_space_->Write(), vector_space_->Write()}));
 }
@@ -254,6 +326,7 @@ TEST_F(BSplineSuite, ThrowIfNotDimensionIsInvalid) {
 
   EXPECT_THROW(b_spline_.InsertKnot(kDimension2, kKnot0_5_), OutOfRange);
   EXPECT_THROW(b_spline_.RemoveKnot(kDimension2, kKnot0_5_, kEpsilon_), OutOfRange);
+  EXPECT_THROW(b_spline_.RemoveKnots(kDimension2, kEpsilon_), OutOfRange);
   EXPECT_THROW(b_spline_.ElevateDegree(kDimension2), OutOfRange);
   EXPECT_THROW(b_spline_.ReduceDegree(kDimension2, kEpsilon_), OutOfRange);
 }
@@ -261,5 +334,11 @@ TEST_F(BSplineSuite, ThrowIfNotDimensionIsInvalid) {
 TEST_F(BSplineSuite, ThrowIfParametricCoordinateIsOutsideScope) {
   EXPECT_THROW(b_spline_.InsertKnot(kDimension0_, ParametricCoordinate{-0.5}), OutOfRange);
 }
+
+TEST_F(BSplineSuite, ThrowIfNumbersOfCoordinatesDiffer) {
+  BSpline_::Coordinates_ coordinates(2);
+  EXPECT_THROW(b_spline_.Evaluate(BSpline_::ParametricCoordinates_{kParametricCoordinate_}, coordinates),
+               InvalidArgument);
+}
 #endif
 }  // namespace splinelib::tests::splines
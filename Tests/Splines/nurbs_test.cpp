@@ -112,6 +112,15 @@ TEST_F(NurbsSuite, Evaluate) {
   // Compare NURBS book Exe. 4.6.
   EXPECT_EQ(nurbs_(kParametricCoordinate_), (Coordinate_{Coordinate{0.8}, Coordinate{0.4}, Coordinate{1.8}}));
   EXPECT_EQ(non_rational_nurbs_(kParametricCoordinate_), b_spline_(kParametricCoordinate_));
+  Nurbs_::EvaluationContext_ evaluation_context{};
+  EXPECT_EQ(nurbs_(kParametricCoordinate_, evaluation_context), nurbs_(kParametricCoordinate_));
+
+  Nurbs_::ParametricCoordinates_ const kParametricCoordinates{{kParametricCoordinate1_0, kParametricCoordinate0_0_},
+                                                              kParametricCoordinate_};
+  Nurbs_::Coordinates_ coordinates(kParametricCoordinates.size());
+  ASSERT_NO_THROW(nurbs_.Evaluate(kParametricCoordinates, coordinates));
+  EXPECT_EQ(coordinates, (Nurbs_::Coordinates_{{kCoordinate0_0_, kCoordinate1_0_, kCoordinate3_0},
+                                               nurbs_(kParametricCoordinate_)}));
 }
 
 TEST_F(NurbsSuite, EvaluateDerivative) {
@@ -156,6 +165,25 @@ TEST_F(NurbsSuite, EvaluateDerivative) {
                                                                                    kDerivative2_2));
 }
 
+TEST_F(NurbsSuite, EvaluateDerivatives) {
+  constexpr Coordinate const kCoordinate0_16{0.16}, kCoordinate0_256{0.256}, kCoordinate0_32{0.32},
+                             kCoordinate1_92{1.92};
+  constexpr splinelib::Derivative const kDerivative1{1};
+
+  EXPECT_EQ(nurbs_.EvaluateDerivatives(kParametricCoordinate_, {kDerivative1, kDerivative1}),
+            (Nurbs_::Coordinates_{nurbs_(kParametricCoordinate_), {kCoordinate0_32, kCoordinate0_16, kCoordinate1_92},
+                {kCoordinate1_92, kCoordinate0_16, kCoordinate0_32}, {kCoordinate0_256, Coordinate{-1.792},
+                                                                      kCoordinate0_256}}));
+
+  Nurbs_::DerivativesWorkspace_ workspace;
+  Nurbs_::Coordinates_ derivatives;
+  for (ParametricCoordinate_ const &parametric_coordinate : {kParametricCoordinate_, ParametricCoordinate_{}}) {
+    ASSERT_NO_THROW(nurbs_.EvaluateDerivatives(parametric_coordinate, {kDerivative1, kDerivative1}, workspace,
+                                               derivatives));
+    EXPECT_EQ(derivatives, nurbs_.EvaluateDerivatives(parametric_coordinate, {kDerivative1, kDerivative1}));
+  }
+}
+
 TEST_F(NurbsSuite, InsertKnot) {
   EXPECT_NO_THROW(nurbs_.InsertKnot(kDimension0_, kKnot0_5_));
 }
@@ -164,6 +192,10 @@ TEST_F(NurbsSuite, RemoveKnot) {
   EXPECT_EQ(nurbs_.RemoveKnot(kDimension0_, kKnot0_5_, kEpsilon_), Multiplicity{});
 }
 
+TEST_F(NurbsSuite, RemoveKnots) {
+  EXPECT_TRUE(nurbs_.RemoveKnots(kDimension0_, kEpsilon_).empty());
+}
+
 TEST_F(NurbsSuite, ElevateDegree) {
   EXPECT_NO_THROW(nurbs_.ElevateDegree(kDimension0_));
 }
@@ -194,6 +226,7 @@ TEST_F(NurbsSuite, ThrowIfNotDimensionIsInvalid) {
 
   EXPECT_THROW(nurbs_.InsertKnot(kDimension2, kKnot0_5_), OutOfRange);
   EXPECT_THROW(nurbs_.RemoveKnot(kDimension2, kKnot0_5_, kEpsilon_), OutOfRange);
+  EXPECT_THROW(nurbs_.RemoveKnots(kDimension2, kEpsilon_), OutOfRange);
   EXPECT_THROW(nurbs_.ElevateDegree(kDimension2), OutOfRange);
   EXPECT_THROW(nurbs_.ReduceDegree(kDimension2, kEpsilon_), OutOfRange);
 }
@@ -108,7 +108,7 @@ TEST_F(SplineSuite, RefineKnots) {
   SharedPointer<ParameterSpace_> parameter_space{make_shared<ParameterSpace_>()};
   parameter_space->NurbsBookExe3_8();
   SharedPointer<VectorSpace_> vector_space{make_shared<VectorSpace_>()};
-  vector_space->NurbsBookExe3_8Insert();
+  vector_space->NurbsBookExe3_8Refine();
   SharedPointer<Spline_> b_spline;
   ASSERT_NO_THROW(b_spline = make_shared<BSpline_>(move(parameter_space), move(vector_space)));
   EXPECT_NO_THROW(b_spline->RefineKnots(kDimension1_, kKnots_));
@@ -142,6 +142,12 @@ TEST_F(SplineSuite, Sample) {
   EXPECT_EQ(nurbs_->Sample(kNumberOfParametricCoordinates), (Coordinates{{kCoordinate0_0, kCoordinate0_0,
                 kCoordinate1_0}, {kCoordinate0_0, kCoordinate1_0, kCoordinate3_0}, {kCoordinate2_0, kCoordinate1_0,
                     kCoordinate1_0}, {kCoordinate2_0, kCoordinate0_0, kCoordinate3_0}}));
+
+  constexpr NumberOfThreads const kNumberOfThreads3{3};
+  EXPECT_EQ(b_spline_->Sample(kNumberOfParametricCoordinates, kNumberOfThreads3),
+            b_spline_->Sample(kNumberOfParametricCoordinates));
+  EXPECT_EQ(nurbs_->Sample(kNumberOfParametricCoordinates, kNumberOfThreads3),
+            nurbs_->Sample(kNumberOfParametricCoordinates));
 }
 
 }  // namespace splinelib::tests::splines
@@ -0,0 +1,88 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <chrono>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include "Sources/Utilities/instrumentation.hpp"
+
+namespace splinelib::tests::utilities::instrumentation {
+
+using namespace sources::utilities::instrumentation;  // NOLINT(build/namespaces)
+using std::get;
+
+// Counts one and two bytes for each copy construction and assignment, respectively.
+class Counted : private CopyCounter<Counted, Counter::kVectorSpaceCopies> {
+ private:
+  friend CopyCounter<Counted, Counter::kVectorSpaceCopies>;
+
+  void CountAllocatedBytesOfCopy(Counted const *target) const {
+    Count(Counter::kBytesAllocated, ((target == nullptr) ? 1 : 2));
+  }
+};
+
+class InstrumentationSuite : public testing::Test {
+ protected:
+  constexpr static int const kSpanSearches_{static_cast<int>(Counter::kSpanSearches)},
+                             kWrite_{static_cast<int>(Phase::kWrite)};
+
+  InstrumentationSuite() { Reset(); }
+};
+
+TEST_F(InstrumentationSuite, CountAndGetSnapshot) {
+  Count(Counter::kSpanSearches);
+  Count(Counter::kSpanSearches, 2);
+  std::thread{[] { Count(Counter::kSpanSearches, 4); }}.join();
+  Statistics const statistics{GetSnapshot()};
+  Counts const &counts = get<0>(statistics);
+  EXPECT_EQ(counts[kSpanSearches_], 7);
+  EXPECT_EQ(counts[static_cast<int>(Counter::kBytesAllocated)], 0);
+  Reset();
+  EXPECT_EQ(get<0>(GetSnapshot())[kSpanSearches_], 0);
+}
+
+TEST_F(InstrumentationSuite, ScopedTimer) {
+  constexpr Duration const kDuration{std::chrono::milliseconds{1}};
+
+  { ScopedTimer const timer{Phase::kWrite}; std::this_thread::sleep_for(kDuration); }
+  { ScopedTimer const timer{Phase::kWrite}; }
+  Statistics const statistics{GetSnapshot()};
+  Timings const &timings = get<1>(statistics);
+  EXPECT_EQ(get<0>(timings[kWrite_]), 2);
+  EXPECT_GE(get<1>(timings[kWrite_]), kDuration);
+  EXPECT_EQ(get<0>(timings[static_cast<int>(Phase::kRead)]), 0);
+}
+
+TEST_F(InstrumentationSuite, CopyCounter) {
+  Counted counted;
+  Counted copied{counted};
+  copied = counted;
+  counted = std::move(copied);
+  Statistics const statistics{GetSnapshot()};
+  Counts const &counts = get<0>(statistics);
+  EXPECT_EQ(counts[static_cast<int>(Counter::kVectorSpaceCopies)], kIsEnabled ? 2 : 0);
+  EXPECT_EQ(counts[static_cast<int>(Counter::kBytesAllocated)], kIsEnabled ? 3 : 0);
+}
+
+TEST_F(InstrumentationSuite, Write) {
+  Count(Counter::kSpanSearches, 3);
+  String const &written = Write(GetSnapshot());
+  EXPECT_NE(written.find("span searches: 3\n"), String::npos);
+  EXPECT_NE(written.find("write: 0 (0 s)\n"), String::npos);
+}
+
+}  // namespace splinelib::tests::utilities::instrumentation
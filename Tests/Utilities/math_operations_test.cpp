@@ -27,11 +27,21 @@ TEST(MathOperationsSuite, ComputeBinomialCoefficient) {
   EXPECT_EQ(ComputeBinomialCoefficient(4, 2), 6);
 }
 
+TEST(MathOperationsSuite, GetBinomialCoefficient) {
+  static_assert(GetBinomialCoefficient(4, 2) == 6);
+  EXPECT_EQ(GetBinomialCoefficient(4, 0), 1);
+  EXPECT_EQ(GetBinomialCoefficient(kMaximumNumberOfElementsInSet, 16), 1166803110);
+  for (int number_of_elements_in_subset{}; number_of_elements_in_subset <= 20; ++number_of_elements_in_subset)
+      EXPECT_EQ(GetBinomialCoefficient(20, number_of_elements_in_subset),
+                ComputeBinomialCoefficient(20, number_of_elements_in_subset));
+}
+
 #ifndef NDEBUG
 TEST(MathOperationsSuite, ThrowIfGreaterNumberOfElementsInSubsetThanInSetOrNegativeNumberOfElementsEncountered) {
   EXPECT_THROW(ComputeBinomialCoefficient(2, 4), InvalidArgument);
   EXPECT_THROW(ComputeBinomialCoefficient(-1, 2), InvalidArgument);
   EXPECT_THROW(ComputeBinomialCoefficient(4, -1), InvalidArgument);
+  EXPECT_THROW(GetBinomialCoefficient(2, 4), InvalidArgument);
 }
 #endif
 }  // namespace splinelib::tests::utilities::math_operations
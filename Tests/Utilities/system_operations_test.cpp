@@ -13,6 +13,11 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include "Sources/Utilities/error_handling.hpp"
 #include "Sources/Utilities/system_operations.hpp"
@@ -37,6 +42,21 @@ TEST_F(SystemOperationsSuite, Open) {
   remove(file_name.c_str());
 }
 
+TEST_F(SystemOperationsSuite, ForEachBlockInParallel) {
+  constexpr int const kNumberOfElements{10};
+
+  std::vector<int> blocks(kNumberOfElements);
+  auto const &mark_block = [&] (int const &first, int const &behind) {
+      std::fill(blocks.begin() + first, blocks.begin() + behind, first); };
+  ASSERT_NO_THROW(ForEachBlockInParallel(0, kNumberOfElements, NumberOfThreads{3}, mark_block));
+  EXPECT_EQ(blocks, (std::vector<int>{0, 0, 0, 3, 3, 3, 6, 6, 6, 6}));
+  ASSERT_NO_THROW(ForEachBlockInParallel(0, kNumberOfElements, NumberOfThreads{20}, mark_block));
+  EXPECT_EQ(blocks, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_THROW(ForEachBlockInParallel(0, kNumberOfElements, NumberOfThreads{2}, [] (int const &first, int const &) {
+                   throw std::runtime_error("Block starting at " + std::to_string(first) + "."); }),
+               std::runtime_error);
+}
+
 #ifndef NDEBUG
 TEST_F(SystemOperationsSuite, ThrowIfFileCannotBeOpened) {
   EXPECT_THROW((Open<InputStream, kModeIn>(file_name)), RuntimeError);
@@ -0,0 +1,56 @@
+/* Copyright (c) 2018–2021 SplineLib
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "Sources/Utilities/tracing.hpp"
+
+namespace splinelib::tests::utilities::tracing {
+
+using namespace sources::utilities::tracing;  // NOLINT(build/namespaces)
+
+class TracingSuite : public testing::Test {
+ protected:
+  TracingSuite() { Start(); }
+  ~TracingSuite() override { Stop(); }
+};
+
+TEST_F(TracingSuite, ScopedSpan) {
+  {
+    ScopedSpan const span{"outer"};
+    { ScopedSpan const nested_span{"inner", "\"quoted\"\\"}; }
+    { ScopedSpan const indexed_span{"indexed", "spline", 3}; }
+    std::thread{[] { ScopedSpan const span{"thread"}; }}.join();
+  }
+  Stop();
+  { ScopedSpan const span{"stopped"}; }
+  String const &written = Write();
+  EXPECT_NE(written.find("{\"name\":\"outer\",\"ph\":\"X\",\"pid\":1,\"tid\":0,"), String::npos);
+  EXPECT_NE(written.find("\"args\":{\"detail\":\"\\\"quoted\\\"\\\\\"}"), String::npos);
+  EXPECT_NE(written.find("\"args\":{\"detail\":\"spline 3\"}"), String::npos);
+  EXPECT_NE(written.find("{\"name\":\"thread\",\"ph\":\"X\",\"pid\":1,\"tid\":"), String::npos);
+  EXPECT_EQ(written.find("{\"name\":\"thread\",\"ph\":\"X\",\"pid\":1,\"tid\":0,"), String::npos);
+  EXPECT_EQ(written.find("stopped"), String::npos);
+}
+
+TEST_F(TracingSuite, Start) {
+  { ScopedSpan const span{"discarded"}; }
+  Start();
+  EXPECT_TRUE(IsRecording());
+  EXPECT_EQ(Write(), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n");
+}
+
+}  // namespace splinelib::tests::utilities::tracing
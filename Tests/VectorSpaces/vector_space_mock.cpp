@@ -23,7 +23,8 @@ namespace {
 
 using Coordinate3d = A3dVectorSpaceMock::Coordinate_;
 using ScalarCoordinate = Coordinate3d::value_type;
-using testing::Assign, testing::InvokeWithoutArgs, testing::Return, testing::ReturnRef, testing::ReturnRefOfCopy;
+using testing::Assign, testing::AtMost, testing::InvokeWithoutArgs, testing::Return, testing::ReturnRef,
+      testing::ReturnRefOfCopy;
 
 constexpr ScalarCoordinate const k0_0{}, k1_0{1.0}, k1_5{1.5}, k2_0{2.0}, k2_5{2.5}, k2_75{2.75}, k3_0{3.0}, k3_5{3.5},
                                  k3_75{3.75}, k4_0{4.0}, k4_5{4.5}, k5_0{5.0}, k5_25{5.25}, k5_5{5.5}, k6_0{6.0},
@@ -62,7 +63,33 @@ A3dVectorSpaceMock::Coordinates_ const kCoordinatesInsertRemove{kCoordinate0_0,
     kCoordinate2_0, kCoordinate3_0, kCoordinateInserted0_1, kCoordinateInserted1_1, kCoordinateInserted2_1,
     kCoordinateInserted3_1, kCoordinateSubdivided0_2, kCoordinateSubdivided1_2, kCoordinateSubdivided2_2,
     kCoordinateSubdivided3_2, kCoordinateInserted0_2, kCoordinateInserted1_2, kCoordinateInserted2_2,
-    kCoordinateInserted3_2, kCoordinate0_2, kCoordinate1_2, kCoordinate2_2, kCoordinate3_2};
+    kCoordinateInserted3_2, kCoordinate0_2, kCoordinate1_2, kCoordinate2_2, kCoordinate3_2},
+    kCoordinatesElevateReduce{kCoordinate0_0, kCoordinateElevatedOnce1_0, kCoordinateElevatedOnce2_0_0,
+    kCoordinateElevatedOnce2_0_1, kCoordinateElevatedOnce3_0, kCoordinate3_0, kCoordinate0_1,
+    kCoordinateElevatedOnce1_1, kCoordinateElevatedOnce2_1_0, kCoordinateElevatedOnce2_1_1, kCoordinateElevatedOnce3_1,
+    kCoordinate3_1, kCoordinate0_2, kCoordinateElevatedOnce1_2, kCoordinateElevatedOnce2_2_0,
+    kCoordinateElevatedOnce2_2_1, kCoordinateElevatedOnce3_2, kCoordinate3_2}, kCoordinatesElevatedTwice{
+    kCoordinate0_0, kCoordinateElevatedTwice1_0, kCoordinateElevatedTwice2_0_1_0, kCoordinateElevatedTwice2_0_0_0,
+    kCoordinateElevatedTwice2_0_0_1, kCoordinateElevatedTwice3_0_1, kCoordinateElevatedTwice3_0_0, kCoordinate3_0,
+    kCoordinate0_1, kCoordinateElevatedTwice1_1, kCoordinateElevatedTwice2_1_1_0, kCoordinateElevatedTwice2_1_0_0,
+    kCoordinateElevatedTwice2_1_0_1, kCoordinateElevatedTwice3_1_1, kCoordinateElevatedTwice3_1_0, kCoordinate3_1,
+    kCoordinate0_2, kCoordinateElevatedTwice1_2, kCoordinateElevatedTwice2_2_1_0, kCoordinateElevatedTwice2_2_0_0,
+    kCoordinateElevatedTwice2_2_0_1, kCoordinateElevatedTwice3_2_1, kCoordinateElevatedTwice3_2_0, kCoordinate3_2},
+    kCoordinatesBezierElevatedReducedOnce{kCoordinate0_0, kCoordinateElevatedOnce1_0, kCoordinateElevatedOnce2_0_0,
+    kCoordinateBezier2_0, kCoordinateElevatedOnce2_0_1, kCoordinateElevatedOnce3_0, kCoordinate3_0, kCoordinate0_1,
+    kCoordinateElevatedOnce1_1, kCoordinateElevatedOnce2_1_0, kCoordinateBezier2_1, kCoordinateElevatedOnce2_1_1,
+    kCoordinateElevatedOnce3_1, kCoordinate3_1, kCoordinate0_2, kCoordinateElevatedOnce1_2,
+    kCoordinateElevatedOnce2_2_0, kCoordinateBezier2_2, kCoordinateElevatedOnce2_2_1, kCoordinateElevatedOnce3_2,
+    kCoordinate3_2},
+    kCoordinatesBezierElevatedTwice{kCoordinate0_0, kCoordinateElevatedTwice1_0, kCoordinateElevatedTwice2_0_1_0,
+    kCoordinateElevatedTwice2_0_0_0, kCoordinateBezier2_0, kCoordinateElevatedTwice2_0_0_1,
+    kCoordinateElevatedTwice3_0_1, kCoordinateElevatedTwice3_0_0, kCoordinate3_0, kCoordinate0_1,
+    kCoordinateElevatedTwice1_1,
+    kCoordinateElevatedTwice2_1_1_0, kCoordinateElevatedTwice2_1_0_0, kCoordinateBezier2_1,
+    kCoordinateElevatedTwice2_1_0_1, kCoordinateElevatedTwice3_1_1, kCoordinateElevatedTwice3_1_0, kCoordinate3_1,
+    kCoordinate0_2, kCoordinateElevatedTwice1_2, kCoordinateElevatedTwice2_2_1_0, kCoordinateElevatedTwice2_2_0_0,
+    kCoordinateBezier2_2, kCoordinateElevatedTwice2_2_0_1, kCoordinateElevatedTwice3_2_1, kCoordinateElevatedTwice3_2_0,
+    kCoordinate3_2};
 
 }  // namespace
 
@@ -104,171 +131,40 @@ void A3dVectorSpaceMock::NurbsBookExe3_8() {
                                                                                                 kPrecision_)}));
 }
 
+void A3dVectorSpaceMock::NurbsBookExe3_8Coarsen() {
+  NurbsBookExe3_8Subdivided();
+
+  EXPECT_CALL(*this, OperatorSubscript(k0)).WillRepeatedly(ReturnRef(kCoordinate0_0));
+  EXPECT_CALL(*this, OperatorSubscript(k1)).WillRepeatedly(ReturnRef(kCoordinate1_0));
+  EXPECT_CALL(*this, OperatorSubscript(k2)).WillRepeatedly(ReturnRef(kCoordinate2_0));
+  EXPECT_CALL(*this, OperatorSubscript(k3)).WillRepeatedly(ReturnRef(kCoordinate3_0));
+  EXPECT_CALL(*this, OperatorSubscript(k16)).WillRepeatedly(ReturnRef(kCoordinate0_2));
+  EXPECT_CALL(*this, OperatorSubscript(k17)).WillRepeatedly(ReturnRef(kCoordinate1_2));
+  EXPECT_CALL(*this, OperatorSubscript(k18)).WillRepeatedly(ReturnRef(kCoordinate2_2));
+  EXPECT_CALL(*this, OperatorSubscript(k19)).WillRepeatedly(ReturnRef(kCoordinate3_2));
+
+  EXPECT_CALL(*this, Replace(Coordinates_{kCoordinate0_0, kCoordinate1_0, kCoordinate2_0, kCoordinate3_0,
+      kCoordinate0_1, kCoordinate1_1, kCoordinate2_1, kCoordinate3_1, kCoordinate0_2, kCoordinate1_2, kCoordinate2_2,
+          kCoordinate3_2})).WillOnce(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8));
+}
+
 void A3dVectorSpaceMock::NurbsBookExe3_8ElevatedTwice() {
-  coordinates_.assign({kCoordinate0_0, kCoordinateElevatedTwice1_0, kCoordinateElevatedTwice2_0_1_0,
-      kCoordinateElevatedTwice2_0_0_0, kCoordinateElevatedTwice2_0_0_1, kCoordinateElevatedTwice3_0_1,
-          kCoordinateElevatedTwice3_0_0, kCoordinate3_0, kCoordinate0_1, kCoordinateElevatedTwice1_1,
-              kCoordinateElevatedTwice2_1_1_0, kCoordinateElevatedTwice2_1_0_0, kCoordinateElevatedTwice2_1_0_1,
-                  kCoordinateElevatedTwice3_1_1, kCoordinateElevatedTwice3_1_0, kCoordinate3_1, kCoordinate0_2,
-                      kCoordinateElevatedTwice1_2, kCoordinateElevatedTwice2_2_1_0, kCoordinateElevatedTwice2_2_0_0,
-                          kCoordinateElevatedTwice2_2_0_1, kCoordinateElevatedTwice3_2_1,
-                              kCoordinateElevatedTwice3_2_0, kCoordinate3_2});
-
-  EXPECT_CALL(*this, OperatorSubscript(k3)).WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_0_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k4)).WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_0_0_1));
+  coordinates_ = kCoordinatesElevatedTwice;
+
+  Index::ForEach(0, 24, [&] (Index const &coordinate) { EXPECT_CALL(*this, OperatorSubscript(coordinate))
+      .WillRepeatedly(ReturnRef(kCoordinatesElevatedTwice[coordinate.Get()])); });
   EXPECT_CALL(*this, GetNumberOfCoordinates()).WillRepeatedly(Return(24));
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8ElevateOnce() {
   NurbsBookExe3_8();
 
-  Expectation_ const &bezier_first0 = EXPECT_CALL(*this, Insert(k2, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k6)).After(bezier_first0).WillRepeatedly(ReturnRef(kCoordinate1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(bezier_first0).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  Expectation_ const &bezier_second0 = EXPECT_CALL(*this, Insert(k7, kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k11)).After(bezier_second0).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(bezier_second0).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  Expectation_ const &bezier_third0 = EXPECT_CALL(*this, Insert(k12, kCoordinateBezier2_2)).After(bezier_second0);
-  NurbsBookExe3_8Bezier(bezier_third0);
-
-  Expectation_ const &insert_first0_0 = EXPECT_CALL(*this, Insert(k2, kCoordinateElevatedOnce2_0_0))
-      .After(bezier_third0);
-  EXPECT_CALL(*this, OperatorSubscript(k3)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k4)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinate2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k5)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinate3_0));
-  EXPECT_CALL(*this, OperatorSubscript(k6)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinate0_1));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinate1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k8)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  Expectation_ const &insert_second0_0 = EXPECT_CALL(*this, Insert(k8, kCoordinateElevatedOnce2_1_0))
-      .After(insert_first0_0);
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k11)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinate3_1));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinate0_2));
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  Expectation_ const &insert_third0_0 = EXPECT_CALL(*this, Insert(k14, kCoordinateElevatedOnce2_2_0))
-      .After(insert_second0_0);
-  Expectation_ const &replace_first0 = EXPECT_CALL(*this, Replace(k1, kCoordinateElevatedOnce1_0))
-      .After(insert_third0_0);
-  Expectation_ const &replace_second0 = EXPECT_CALL(*this, Replace(k7, kCoordinateElevatedOnce1_1))
-      .After(replace_first0);
-  Expectation_ const &replace_third0 = EXPECT_CALL(*this, Replace(k13, kCoordinateElevatedOnce1_2))
-      .After(replace_second0);
-
-  Expectation_ const &insert_first0_1 = EXPECT_CALL(*this, Insert(k5, kCoordinateElevatedOnce3_0))
-      .After(replace_third0);
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k11)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate3_1));
-  Expectation_ const &insert_second0_1 = EXPECT_CALL(*this, Insert(k12, kCoordinateElevatedOnce3_1))
-      .After(insert_first0_1);
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k18)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k19)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinate3_2));
-  Expectation_ const &insert_third0_1 = EXPECT_CALL(*this, Insert(k19, kCoordinateElevatedOnce3_2))
-      .After(insert_second0_1);
-  Expectation_ const &replace_first1 = EXPECT_CALL(*this, Replace(k4, kCoordinateElevatedOnce2_0_1))
-      .After(insert_third0_1);
-  Expectation_ const &replace_second1 = EXPECT_CALL(*this, Replace(k11, kCoordinateElevatedOnce2_1_1))
-      .After(replace_first1);
-  Expectation_ const &replace_third1 =  EXPECT_CALL(*this, Replace(k18, kCoordinateElevatedOnce2_2_1))
-      .After(replace_second1);
-  NurbsBookExe3_8BezierElevatedReducedOnce(replace_third1);
-
-  Expectation_ const &b_spline_first = EXPECT_CALL(*this, Erase(k17)).After(replace_third1);
-  Expectation_ const &b_spline_second = EXPECT_CALL(*this, Erase(k10)).After(b_spline_first);
-  Expectation_ const &b_spline_third = EXPECT_CALL(*this, Erase(k3)).After(b_spline_second);
-  NurbsBookExe3_8ElevateReduce(b_spline_third);
-
-  Expectation_ const &bezier_first1 = EXPECT_CALL(*this, Insert(k3, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(bezier_first1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_0));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(bezier_first1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_1));
-  Expectation_ const &bezier_second1 = EXPECT_CALL(*this, Insert(k10, kCoordinateBezier2_1)).After(bezier_first1);
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(bezier_second1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(bezier_second1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_1));
-  Expectation_ const &bezier_third1 = EXPECT_CALL(*this, Insert(k17, kCoordinateBezier2_2)).After(bezier_second1);
-  NurbsBookExe3_8BezierElevatedReducedOnce(bezier_third1);
-
-  Expectation_ const &insert_first1_0 = EXPECT_CALL(*this, Insert(k3, kCoordinateElevatedTwice2_0_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k4)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k5)).After(insert_first1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_0_1));
-  EXPECT_CALL(*this, OperatorSubscript(k6)).After(insert_first1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce3_0));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinate3_0));
-  EXPECT_CALL(*this, OperatorSubscript(k8)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinate0_1));
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(insert_first1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_first1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_0));
-  EXPECT_CALL(*this, OperatorSubscript(k11)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  Expectation_ const &insert_second1_0 = EXPECT_CALL(*this, Insert(k11, kCoordinateElevatedTwice2_1_0_0))
-      .After(insert_first1_0);
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(insert_second1_0).WillRepeatedly(ReturnRef(kCoordinate0_2));
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(insert_second1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k18)).After(insert_second1_0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k19)).After(insert_second1_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  Expectation_ const &insert_third1_0 = EXPECT_CALL(*this, Insert(k19, kCoordinateElevatedTwice2_2_0_0))
-      .After(insert_second1_0);
-  Expectation_ const &replace_first0_0 = EXPECT_CALL(*this, Replace(k2, kCoordinateElevatedTwice2_0_1_0))
-      .After(insert_third1_0);
-  Expectation_ const &replace_second0_0 = EXPECT_CALL(*this, Replace(k10, kCoordinateElevatedTwice2_1_1_0))
-      .After(replace_first0_0);
-  Expectation_ const &replace_third0_0 = EXPECT_CALL(*this, Replace(k18, kCoordinateElevatedTwice2_2_1_0))
-      .After(replace_second0_0);
-  Expectation_ const &replace_first0_1 = EXPECT_CALL(*this, Replace(k1, kCoordinateElevatedTwice1_0))
-      .After(replace_third0_0);
-  Expectation_ const &replace_second0_1 = EXPECT_CALL(*this, Replace(k9, kCoordinateElevatedTwice1_1))
-      .After(replace_first0_1);
-  Expectation_ const &replace_third0_1 = EXPECT_CALL(*this, Replace(k17, kCoordinateElevatedTwice1_2))
-      .After(replace_second0_1);
-
-  Expectation_ const &insert_first1_1 = EXPECT_CALL(*this, Insert(k7, kCoordinateElevatedTwice3_0_0))
-      .After(replace_third0_1);
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(insert_first1_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_first1_1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k15)).After(insert_first1_1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce3_1));
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(insert_first1_1).WillRepeatedly(ReturnRef(kCoordinate3_1));
-  Expectation_ const &insert_second1_1 = EXPECT_CALL(*this, Insert(k16, kCoordinateElevatedTwice3_1_0))
-      .After(insert_first1_1);
-  EXPECT_CALL(*this, OperatorSubscript(k22)).After(insert_second1_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k23)).After(insert_second1_1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k24)).After(insert_second1_1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce3_2));
-  EXPECT_CALL(*this, OperatorSubscript(k25)).After(insert_second1_1).WillRepeatedly(ReturnRef(kCoordinate3_2));
-  Expectation_ const &insert_third1_1 = EXPECT_CALL(*this, Insert(k25, kCoordinateElevatedTwice3_2_0))
-      .After(insert_second1_1);
-  Expectation_ const &replace_first1_0 = EXPECT_CALL(*this, Replace(k6, kCoordinateElevatedTwice3_0_1))
-      .After(insert_third1_1);
-  Expectation_ const &replace_second1_0 = EXPECT_CALL(*this, Replace(k15, kCoordinateElevatedTwice3_1_1))
-      .After(replace_first1_0);
-  Expectation_ const &replace_third1_0 = EXPECT_CALL(*this, Replace(k24, kCoordinateElevatedTwice3_2_1))
-      .After(replace_second1_0);
-  Expectation_ const &replace_first1_1 = EXPECT_CALL(*this, Replace(k5, kCoordinateElevatedTwice2_0_0_1))
-      .After(replace_third1_0);
-  Expectation_ const &replace_second1_1 = EXPECT_CALL(*this, Replace(k14, kCoordinateElevatedTwice2_1_0_1))
-      .After(replace_first1_1);
-  Expectation_ const &replace_third1_1 = EXPECT_CALL(*this, Replace(k23, kCoordinateElevatedTwice2_2_0_1))
-      .After(replace_second1_1);
-  NurbsBookExe3_8BezierElevatedTwiceMakeBSpline(replace_third1_1);
+  EXPECT_CALL(*this, Replace(kCoordinatesElevateReduce))
+      .WillOnce(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8ElevateReduceElevateOnce));
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8ElevateReduce() {
-  coordinates_.assign({kCoordinate0_0, kCoordinateElevatedOnce1_0, kCoordinateElevatedOnce2_0_0,
-      kCoordinateElevatedOnce2_0_1, kCoordinateElevatedOnce3_0, kCoordinate3_0, kCoordinate0_1,
-      kCoordinateElevatedOnce1_1, kCoordinateElevatedOnce2_1_0, kCoordinateElevatedOnce2_1_1,
-      kCoordinateElevatedOnce3_1, kCoordinate3_1, kCoordinate0_2, kCoordinateElevatedOnce1_2,
-      kCoordinateElevatedOnce2_2_0, kCoordinateElevatedOnce2_2_1, kCoordinateElevatedOnce3_2, kCoordinate3_2});
+  coordinates_ = kCoordinatesElevateReduce;
 
   EXPECT_CALL(*this, GetNumberOfCoordinates()).WillRepeatedly(Return(18));
 }
@@ -276,107 +172,17 @@ void A3dVectorSpaceMock::NurbsBookExe3_8ElevateReduce() {
 void A3dVectorSpaceMock::NurbsBookExe3_8ElevateTwice() {
   NurbsBookExe3_8();
 
-  Expectation_ const &bezier_first = EXPECT_CALL(*this, Insert(k2, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k6)).After(bezier_first).WillRepeatedly(ReturnRef(kCoordinate1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(bezier_first).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  Expectation_ const &bezier_second = EXPECT_CALL(*this, Insert(k7, kCoordinateBezier2_1)).After(bezier_first);
-  EXPECT_CALL(*this, OperatorSubscript(k11)).After(bezier_second).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(bezier_second).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  Expectation_ const &bezier_third = EXPECT_CALL(*this, Insert(k12, kCoordinateBezier2_2)).After(bezier_second);
-  NurbsBookExe3_8Bezier(bezier_third);
-
-  Expectation_ const &insert_first0_0 = EXPECT_CALL(*this, Insert(k2, kCoordinateElevatedTwice2_0_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k3)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinate1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k8)).After(insert_first0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  Expectation_ const &insert_second0_0 = EXPECT_CALL(*this, Insert(k8, kCoordinateElevatedTwice2_1_0_0))
-      .After(insert_first0_0);
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_second0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  Expectation_ const &insert_third0_0 = EXPECT_CALL(*this, Insert(k14, kCoordinateElevatedTwice2_2_0_0))
-      .After(insert_second0_0);
-  EXPECT_CALL(*this, OperatorSubscript(k15)).After(insert_third0_0).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  Expectation_ const &insert_first0_1 = EXPECT_CALL(*this, Insert(k2, kCoordinateElevatedTwice2_0_1_0))
-      .After(insert_third0_0);
-  EXPECT_CALL(*this, OperatorSubscript(k4)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k5)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k6)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate3_0));
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate0_1));
-  EXPECT_CALL(*this, OperatorSubscript(k8)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinate1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_first0_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  Expectation_ const &insert_second0_1 = EXPECT_CALL(*this, Insert(k9, kCoordinateElevatedTwice2_1_1_0))
-      .After(insert_first0_1);
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinate0_2));
-  EXPECT_CALL(*this, OperatorSubscript(k15)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(insert_second0_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  Expectation_ const &insert_third0_1 = EXPECT_CALL(*this, Insert(k16, kCoordinateElevatedTwice2_2_1_0))
-      .After(insert_first0_1);
-  Expectation_ const &replace_first0 = EXPECT_CALL(*this, Replace(k1, kCoordinateElevatedTwice1_0))
-      .After(insert_third0_1);
-  Expectation_ const &replace_second0 = EXPECT_CALL(*this, Replace(k8, kCoordinateElevatedTwice1_1))
-      .After(replace_first0);
-  Expectation_ const &replace_third0 = EXPECT_CALL(*this, Replace(k15, kCoordinateElevatedTwice1_2))
-      .After(replace_second0);
-
-  Expectation_ const &insert_first1_0 = EXPECT_CALL(*this, Insert(k6, kCoordinateElevatedTwice3_0_0))
-      .After(replace_third0);
-  EXPECT_CALL(*this, OperatorSubscript(k7)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinate3_0));
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_first1_0).WillRepeatedly(ReturnRef(kCoordinate3_1));
-  Expectation_ const &insert_second1_0 = EXPECT_CALL(*this, Insert(k14, kCoordinateElevatedTwice3_1_0))
-      .After(insert_first1_0);
-  EXPECT_CALL(*this, OperatorSubscript(k21)).After(insert_second1_0).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k22)).After(insert_second1_0).WillRepeatedly(ReturnRef(kCoordinate3_2));
-  Expectation_ const &insert_third1_0 = EXPECT_CALL(*this, Insert(k22, kCoordinateElevatedTwice3_2_0))
-      .After(insert_second1_0);
-  Expectation_ const &insert_first1_1 = EXPECT_CALL(*this, Insert(k6, kCoordinateElevatedTwice3_0_1))
-      .After(insert_third1_0);
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(insert_first1_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_first1_1).WillRepeatedly(ReturnRef(kCoordinate2_1));
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(insert_first1_1).WillRepeatedly(ReturnRef(kCoordinate3_1));
-  Expectation_ const &insert_second1_1 = EXPECT_CALL(*this, Insert(k15, kCoordinateElevatedTwice3_1_1))
-      .After(insert_first1_1);
-  EXPECT_CALL(*this, OperatorSubscript(k22)).After(insert_second1_1).WillRepeatedly(ReturnRef(kCoordinateBezier2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k23)).After(insert_second1_1).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  EXPECT_CALL(*this, OperatorSubscript(k25)).After(insert_second1_1).WillRepeatedly(ReturnRef(kCoordinate3_2));
-  Expectation_ const &insert_third1_1 = EXPECT_CALL(*this, Insert(k24, kCoordinateElevatedTwice3_2_1))
-      .After(insert_second1_1);
-  Expectation_ const &replace_first1 = EXPECT_CALL(*this, Replace(k5, kCoordinateElevatedTwice2_0_0_1))
-      .After(insert_third1_1);
-  Expectation_ const &replace_second1 = EXPECT_CALL(*this, Replace(k14, kCoordinateElevatedTwice2_1_0_1))
-      .After(replace_first1);
-  Expectation_ const &replace_third1 = EXPECT_CALL(*this, Replace(k23, kCoordinateElevatedTwice2_2_0_1))
-      .After(replace_second1);
-  NurbsBookExe3_8BezierElevatedTwiceMakeBSpline(replace_third1);
+  EXPECT_CALL(*this, Replace(kCoordinatesElevatedTwice))
+      .WillOnce(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8ElevatedTwice));
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8Insert() {
   NurbsBookExe3_8();
 
-  Expectation_ const &insert_first0 = EXPECT_CALL(*this, Insert(k8, kCoordinateInserted0_2));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_first0).WillRepeatedly(ReturnRef(kCoordinate1_2));
-  Expectation_ const &replace_first = EXPECT_CALL(*this, Replace(k4, kCoordinateInserted0_1)).After(insert_first0);
-  Expectation_ const &insert_second0 = EXPECT_CALL(*this, Insert(k9, kCoordinateInserted1_2)).After(replace_first);
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(insert_second0).WillRepeatedly(ReturnRef(kCoordinate2_2));
-  Expectation_ const &replace_second = EXPECT_CALL(*this, Replace(k5, kCoordinateInserted1_1)).After(insert_second0);
-  Expectation_ const &insert_third0 = EXPECT_CALL(*this, Insert(k10, kCoordinateInserted2_2)).After(replace_second);
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_third0).WillRepeatedly(ReturnRef(kCoordinate3_2));
-  Expectation_ const &replace_third = EXPECT_CALL(*this, Replace(k6, kCoordinateInserted2_1)).After(insert_third0);
-  Expectation_ const &insert_fourth0 = EXPECT_CALL(*this, Insert(k11, kCoordinateInserted3_2)).After(replace_third);
-  Expectation_ const &replace_fourth = EXPECT_CALL(*this, Replace(k7, kCoordinateInserted3_1)).After(insert_fourth0)
-      .WillOnce(Assign(&coordinates_, kCoordinatesInsertRemove));
-  NurbsBookExe3_8InsertRemove(replace_fourth);
-
-  Expectation_ const &insert_first1 = EXPECT_CALL(*this, Insert(k8, kCoordinateSubdivided0_2)).After(replace_fourth);
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(insert_first1).WillRepeatedly(ReturnRef(kCoordinateInserted1_2));
-  Expectation_ const &insert_second1 = EXPECT_CALL(*this, Insert(k9, kCoordinateSubdivided1_2)).After(insert_first1);
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(insert_second1).WillRepeatedly(ReturnRef(kCoordinateInserted2_2));
-  Expectation_ const &insert_third1 = EXPECT_CALL(*this, Insert(k10, kCoordinateSubdivided2_2)).After(insert_second1);
-  EXPECT_CALL(*this, OperatorSubscript(k14)).After(insert_third1).WillRepeatedly(ReturnRef(kCoordinateInserted3_2));
-  Expectation_ const &insert_fourth1 = EXPECT_CALL(*this, Insert(k11, kCoordinateSubdivided3_2)).After(insert_third1)
-      .WillOnce(Assign(&coordinates_, kCoordinatesSubdivided));
-  NurbsBookExe3_8Subdivided(insert_fourth1);
+  EXPECT_CALL(*this, Replace(kCoordinatesInsertRemove)).Times(AtMost(1))
+      .WillRepeatedly(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8InsertRemoveInsert));
+  EXPECT_CALL(*this, Replace(kCoordinatesSubdivided)).Times(AtMost(1))
+      .WillRepeatedly(Assign(&coordinates_, kCoordinatesSubdivided));
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8InsertRemove() {
@@ -393,24 +199,22 @@ void A3dVectorSpaceMock::NurbsBookExe3_8Perturbed() {
   EXPECT_CALL(*this, GetNumberOfCoordinates()).WillRepeatedly(Return(12));
 }
 
+void A3dVectorSpaceMock::NurbsBookExe3_8Refine() {
+  NurbsBookExe3_8();
+
+  Expectation_ const &replace = EXPECT_CALL(*this, Replace(kCoordinatesSubdivided))
+                                    .WillOnce(Assign(&coordinates_, kCoordinatesSubdivided));
+  NurbsBookExe3_8Subdivided(replace);
+}
+
 void A3dVectorSpaceMock::NurbsBookExe3_8ReduceOnce() {
   NurbsBookExe3_8ElevatedTwice();
 
-  Expectation_ const &bezier_first0 = EXPECT_CALL(*this, Insert(k4, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(bezier_first0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_1_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(bezier_first0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_1_0_1));
-  Expectation_ const &bezier_second0 = EXPECT_CALL(*this, Insert(k13, kCoordinateBezier2_1)).After(bezier_first0);
-  EXPECT_CALL(*this, OperatorSubscript(k21)).After(bezier_second0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_2_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k22)).After(bezier_second0)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_2_0_1));
-  Expectation_ const &bezier_third0 = EXPECT_CALL(*this, Insert(k22, kCoordinateBezier2_2)).After(bezier_second0);
-  NurbsBookExe3_8BezierElevatedTwice(bezier_third0);
+  Expectation_ const &bezier0 = EXPECT_CALL(*this, Replace(kCoordinatesBezierElevatedTwice));
+  NurbsBookExe3_8BezierElevatedTwice(bezier0);
 
   Expectation_ const &replace_first0_0 = EXPECT_CALL(*this, Replace(k23, kCoordinateElevatedOnce2_2_1))
-      .After(bezier_third0);
+      .After(bezier0);
   EXPECT_CALL(*this, OperatorSubscript(k23)).After(replace_first0_0)
       .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_1));
   Expectation_ const &replace_second0_0 = EXPECT_CALL(*this, Replace(k14, kCoordinateElevatedOnce2_1_1))
@@ -487,20 +291,11 @@ void A3dVectorSpaceMock::NurbsBookExe3_8ReduceOnce() {
   Expectation_ const &b_spline_third0 = EXPECT_CALL(*this, Erase(k3)).After(b_spline_second0);
   NurbsBookExe3_8ElevateReduce(b_spline_third0);
 
-  Expectation_ const &bezier_first1 = EXPECT_CALL(*this, Insert(k3, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(bezier_first1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_0));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(bezier_first1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_1));
-  Expectation_ const &bezier_second1 = EXPECT_CALL(*this, Insert(k10, kCoordinateBezier2_1)).After(bezier_first1);
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(bezier_second1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(bezier_second1)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_2_1));
-  Expectation_ const &bezier_third1 = EXPECT_CALL(*this, Insert(k17, kCoordinateBezier2_2)).After(bezier_second1);
-  NurbsBookExe3_8BezierElevatedReducedOnce(bezier_third1);
+  Expectation_ const &bezier1 = EXPECT_CALL(*this, Replace(kCoordinatesBezierElevatedReducedOnce))
+                                    .After(b_spline_third0);
+  NurbsBookExe3_8BezierElevatedReducedOnce(bezier1);
 
-  Expectation_ const &replace_first0 = EXPECT_CALL(*this, Replace(k18, kCoordinate2_2));
+  Expectation_ const &replace_first0 = EXPECT_CALL(*this, Replace(k18, kCoordinate2_2)).After(bezier1);
   EXPECT_CALL(*this, OperatorSubscript(k18)).After(replace_first0).WillRepeatedly(ReturnRef(kCoordinate2_2));
   Expectation_ const &replace_second0 = EXPECT_CALL(*this, Replace(k11, kCoordinate2_1)).After(replace_first0);
   EXPECT_CALL(*this, OperatorSubscript(k11)).After(replace_second0).WillRepeatedly(ReturnRef(kCoordinate2_1));
@@ -536,20 +331,10 @@ void A3dVectorSpaceMock::NurbsBookExe3_8ReduceOnce() {
 void A3dVectorSpaceMock::NurbsBookExe3_8ReduceTwice() {
   NurbsBookExe3_8ElevatedTwice();
 
-  Expectation_ const &bezier_first = EXPECT_CALL(*this, Insert(k4, kCoordinateBezier2_0));
-  EXPECT_CALL(*this, OperatorSubscript(k12)).After(bezier_first)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_1_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k13)).After(bezier_first)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_1_0_1));
-  Expectation_ const &bezier_second = EXPECT_CALL(*this, Insert(k13, kCoordinateBezier2_1)).After(bezier_first);
-  EXPECT_CALL(*this, OperatorSubscript(k21)).After(bezier_second)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_2_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k22)).After(bezier_second)
-      .WillRepeatedly(ReturnRef(kCoordinateElevatedTwice2_2_0_1));
-  Expectation_ const &bezier_third = EXPECT_CALL(*this, Insert(k22, kCoordinateBezier2_2)).After(bezier_second);
-  NurbsBookExe3_8BezierElevatedTwice(bezier_third);
+  Expectation_ const &bezier = EXPECT_CALL(*this, Replace(kCoordinatesBezierElevatedTwice));
+  NurbsBookExe3_8BezierElevatedTwice(bezier);
 
-  Expectation_ const &replace_first0_0 = EXPECT_CALL(*this, Replace(k23, kCoordinate2_2));
+  Expectation_ const &replace_first0_0 = EXPECT_CALL(*this, Replace(k23, kCoordinate2_2)).After(bezier);
   EXPECT_CALL(*this, OperatorSubscript(k23)).After(replace_first0_0).WillRepeatedly(ReturnRef(kCoordinate2_2));
   Expectation_ const &replace_second0_0 = EXPECT_CALL(*this, Replace(k14, kCoordinate2_1)).After(replace_first0_0);
   EXPECT_CALL(*this, OperatorSubscript(k14)).After(replace_second0_0).WillRepeatedly(ReturnRef(kCoordinate2_1));
@@ -765,15 +550,6 @@ void A3dVectorSpaceMock::NurbsBookExe3_8BezierElevatedTwice(Expectation_ const &
   EXPECT_CALL(*this, OperatorSubscript(Index{26})).After(expectation).WillRepeatedly(ReturnRef(kCoordinate3_2));
 }
 
-void A3dVectorSpaceMock::NurbsBookExe3_8BezierElevatedTwiceMakeBSpline(Expectation_ const &expectation) {
-  NurbsBookExe3_8BezierElevatedTwice(expectation);
-
-  Expectation_ const &b_spline_first = EXPECT_CALL(*this, Erase(k22)).After(expectation);
-  Expectation_ const &b_spline_second = EXPECT_CALL(*this, Erase(k13)).After(b_spline_first);
-  EXPECT_CALL(*this, Erase(k4)).After(b_spline_second)
-      .WillOnce(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8ElevatedTwice));
-}
-
 void A3dVectorSpaceMock::NurbsBookExe3_8BezierReducedTwiceMakeBSpline(Expectation_ const &expectation) {
   NurbsBookExe3_8Bezier(expectation);
 
@@ -784,18 +560,28 @@ void A3dVectorSpaceMock::NurbsBookExe3_8BezierReducedTwiceMakeBSpline(Expectatio
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8ElevateReduce(Expectation_ const &expectation) {
-  coordinates_.assign({kCoordinate0_0, kCoordinateElevatedOnce1_0, kCoordinateElevatedOnce2_0_0,
-      kCoordinateElevatedOnce2_0_1, kCoordinateElevatedOnce3_0, kCoordinate3_0, kCoordinate0_1,
-      kCoordinateElevatedOnce1_1, kCoordinateElevatedOnce2_1_0, kCoordinateElevatedOnce2_1_1,
-      kCoordinateElevatedOnce3_1, kCoordinate3_1, kCoordinate0_2, kCoordinateElevatedOnce1_2,
-      kCoordinateElevatedOnce2_2_0, kCoordinateElevatedOnce2_2_1, kCoordinateElevatedOnce3_2, kCoordinate3_2});
+  coordinates_ = kCoordinatesElevateReduce;
 
-  EXPECT_CALL(*this, OperatorSubscript(k2)).After(expectation).WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_0_0));
-  EXPECT_CALL(*this, OperatorSubscript(k3)).After(expectation).WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_0_1));
-  EXPECT_CALL(*this, OperatorSubscript(k9)).After(expectation).WillRepeatedly(ReturnRef(kCoordinateElevatedOnce2_1_1));
-  EXPECT_CALL(*this, OperatorSubscript(k10)).After(expectation).WillRepeatedly(ReturnRef(kCoordinateElevatedOnce3_1));
-  EXPECT_CALL(*this, OperatorSubscript(k16)).After(expectation).WillRepeatedly(ReturnRef(kCoordinateElevatedOnce3_2));
-  EXPECT_CALL(*this, OperatorSubscript(k17)).After(expectation).WillRepeatedly(ReturnRef(kCoordinate3_2));
+  Index::ForEach(0, 18, [&] (Index const &coordinate) { EXPECT_CALL(*this, OperatorSubscript(coordinate))
+      .After(expectation).WillRepeatedly(ReturnRef(kCoordinatesElevateReduce[coordinate.Get()])); });
+  EXPECT_CALL(*this, GetNumberOfCoordinates()).After(expectation).WillRepeatedly(Return(18));
+}
+
+void A3dVectorSpaceMock::NurbsBookExe3_8ElevateReduceElevateOnce() {
+  NurbsBookExe3_8ElevateReduce();
+
+  Index::ForEach(0, 18, [&] (Index const &coordinate) { EXPECT_CALL(*this, OperatorSubscript(coordinate))
+      .WillRepeatedly(ReturnRef(kCoordinatesElevateReduce[coordinate.Get()])); });
+  EXPECT_CALL(*this, Replace(kCoordinatesElevatedTwice))
+      .WillOnce(InvokeWithoutArgs(this, &A3dVectorSpaceMock::NurbsBookExe3_8ElevatedTwice));
+}
+
+void A3dVectorSpaceMock::NurbsBookExe3_8InsertRemoveInsert() {
+  NurbsBookExe3_8InsertRemove();
+
+  Index::ForEach(0, 16, [&] (Index const &coordinate) { EXPECT_CALL(*this, OperatorSubscript(coordinate))
+      .WillRepeatedly(ReturnRef(kCoordinatesInsertRemove[coordinate.Get()])); });
+  EXPECT_CALL(*this, Replace(kCoordinatesSubdivided)).WillOnce(Assign(&coordinates_, kCoordinatesSubdivided));
 }
 
 void A3dVectorSpaceMock::NurbsBookExe3_8InsertRemove(Expectation_ const &expectation) {
@@ -34,6 +34,7 @@ class A3dVectorSpaceMock : public VectorSpace<3> {
   Coordinate_ const & operator[](Index const &coordinate) const final;
   MOCK_METHOD(int, GetNumberOfCoordinates, (), (const, final));
   MOCK_METHOD(void, Replace, (Index const &, Coordinate_), (final));
+  MOCK_METHOD(void, Replace, (Coordinates_), (final));
   MOCK_METHOD(void, Insert, (Index const &, Coordinate_), (final));
   MOCK_METHOD(void, Erase, (Index const &), (final));
 
@@ -43,6 +44,7 @@ class A3dVectorSpaceMock : public VectorSpace<3> {
   OutputInformation_ Write(Precision const &precision = kPrecision_) const final;
 
   void NurbsBookExe3_8();  // See NURBS book Exe. 3.8.
+  void NurbsBookExe3_8Coarsen();
   void NurbsBookExe3_8ElevatedTwice();
   void NurbsBookExe3_8ElevateOnce();
   void NurbsBookExe3_8ElevateReduce();
@@ -50,6 +52,7 @@ class A3dVectorSpaceMock : public VectorSpace<3> {
   void NurbsBookExe3_8Insert();
   void NurbsBookExe3_8InsertRemove();
   void NurbsBookExe3_8Perturbed();
+  void NurbsBookExe3_8Refine();
   void NurbsBookExe3_8ReduceOnce();
   void NurbsBookExe3_8ReduceTwice();
   void NurbsBookExe3_8Remove();
@@ -65,10 +68,11 @@ class A3dVectorSpaceMock : public VectorSpace<3> {
   void NurbsBookExe3_8Bezier(Expectation_ const &expectation);
   void NurbsBookExe3_8BezierElevatedReducedOnce(Expectation_ const &expectation);
   void NurbsBookExe3_8BezierElevatedTwice(Expectation_ const &expectation);
-  void NurbsBookExe3_8BezierElevatedTwiceMakeBSpline(Expectation_ const &expectation);
   void NurbsBookExe3_8BezierReducedTwiceMakeBSpline(Expectation_ const &expectation);
   void NurbsBookExe3_8ElevateReduce(Expectation_ const &expectation);
+  void NurbsBookExe3_8ElevateReduceElevateOnce();
   void NurbsBookExe3_8InsertRemove(Expectation_ const &expectation);
+  void NurbsBookExe3_8InsertRemoveInsert();
   void NurbsBookExe3_8Subdivided(Expectation_ const &expectation);
 };
 
@@ -13,7 +13,9 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 #include <gtest/gtest.h>
 #include "Sources/Utilities/error_handling.hpp"
@@ -74,6 +76,12 @@ TEST_F(VectorSpaceSuite, Replace) {
   EXPECT_EQ(vector_space_, VectorSpace_{coordinates_});
 }
 
+TEST_F(VectorSpaceSuite, ReplaceAll) {
+  coordinates_.insert(kIndex_, kCoordinate4_);
+  EXPECT_NO_THROW(vector_space_.Replace(coordinates_));
+  EXPECT_EQ(vector_space_, VectorSpace_{coordinates_});
+}
+
 TEST_F(VectorSpaceSuite, Insert) {
   coordinates_.insert(kIndex_, kCoordinate4_);
   EXPECT_NO_THROW(vector_space_.Insert(kIndex4_, kCoordinate4_));
@@ -86,6 +94,149 @@ TEST_F(VectorSpaceSuite, Erase) {
   EXPECT_EQ(vector_space_, VectorSpace_{coordinates_});
 }
 
+TEST_F(VectorSpaceSuite, Restructure) {
+  using Lengths = Array<Length, 2>;
+
+  constexpr Dimension const kDimension0{};
+  constexpr Length const k3{3}, k4{4}, k5{5};
+
+  for (int const &index : {8, 4, 0}) coordinates_.insert(coordinates_.begin() + index, coordinates_[index]);
+  EXPECT_NO_THROW(vector_space_.Restructure(kDimension0, Lengths{k4, k3}, Lengths{k5, k3},
+                                            [] (Coordinates_ const &line, Coordinates_ &restructured_line) {
+      restructured_line.front() = line.front();
+      std::copy(line.begin(), line.end(), restructured_line.begin() + 1); }));
+  EXPECT_EQ(vector_space_, VectorSpace_{coordinates_});
+}
+
+TEST_F(VectorSpaceSuite, CommitAndRollbackTransactions) {
+  constexpr Index const kIndex0{}, kIndex11{11};
+
+  VectorSpace_ const vector_space{coordinates_};
+  vector_space_.BeginTransaction();
+  vector_space_.Replace(kIndex4_, kCoordinate0_);
+  vector_space_.Erase(kIndex11);
+  vector_space_.BeginTransaction();
+  vector_space_.Insert(kIndex0, kCoordinate4_);
+  vector_space_.Replace(Coordinates_{kCoordinate4_});
+  vector_space_.Erase(kIndex0);
+  ASSERT_NO_THROW(vector_space_.CommitTransaction());
+  EXPECT_EQ(vector_space_.GetNumberOfCoordinates(), 0);
+  ASSERT_NO_THROW(vector_space_.RollbackTransaction());
+  EXPECT_EQ(vector_space_, vector_space);
+
+  coordinates_.erase(kIndex_);
+  vector_space_.BeginTransaction();
+  vector_space_.Erase(kIndex4_);
+  vector_space_.BeginTransaction();
+  vector_space_.Replace(kIndex4_, kCoordinate0_);
+  ASSERT_NO_THROW(vector_space_.RollbackTransaction());
+  ASSERT_NO_THROW(vector_space_.CommitTransaction());
+  EXPECT_EQ(vector_space_, VectorSpace_{coordinates_});
+}
+
+TEST_F(VectorSpaceSuite, GetComponentDependingOnLayout) {
+  using sources::vector_spaces::Layout;
+  using Component = VectorSpace_::Component_;
+
+  constexpr Dimension const kDimension0{}, kDimension1{1}, kDimension2{2};
+  constexpr Index const kIndex0{};
+
+  auto const &does_store_coordinates = [&] (VectorSpace_ const &vector_space) {
+      for (Dimension const &component : {kDimension0, kDimension1, kDimension2}) {
+        Component const &values = vector_space.GetComponent(component);
+        if ((reinterpret_cast<std::uintptr_t>(values.data()) % VectorSpace_::kComponentAlignment != 0) ||
+            (static_cast<int>(values.size()) != vector_space.GetNumberOfCoordinates())) return false;
+        for (int coordinate{}; coordinate < static_cast<int>(coordinates_.size()); ++coordinate)
+            if (values[coordinate] != coordinates_[coordinate][component.Get()].Get()) return false;
+      }
+      return true; };
+  Coordinates_ const coordinates{coordinates_};
+  VectorSpace_ vector_space{coordinates_, Layout::kStructureOfArrays};
+  EXPECT_EQ(vector_space.GetLayout(), Layout::kStructureOfArrays);
+  EXPECT_EQ(vector_space_.GetLayout(), Layout::kArrayOfStructures);
+  EXPECT_EQ(vector_space, vector_space_);
+  EXPECT_TRUE(does_store_coordinates(vector_space));
+
+  vector_space.BeginTransaction();
+  coordinates_[kIndex4_.Get()] = kCoordinate0_;
+  vector_space.Replace(kIndex4_, kCoordinate0_);
+  EXPECT_TRUE(does_store_coordinates(vector_space));
+  coordinates_.erase(coordinates_.begin());
+  vector_space.Erase(kIndex0);
+  EXPECT_TRUE(does_store_coordinates(vector_space));
+  for (int insertion{}; insertion < 6; ++insertion) {  // Exceeds the padding.
+    coordinates_.insert(coordinates_.begin(), kCoordinate4_);
+    vector_space.Insert(kIndex0, kCoordinate4_);
+    EXPECT_TRUE(does_store_coordinates(vector_space));
+  }
+  coordinates_.resize(1);
+  vector_space.Replace(Coordinates_{kCoordinate4_});
+  EXPECT_TRUE(does_store_coordinates(vector_space));
+  vector_space.RollbackTransaction();
+  EXPECT_EQ(vector_space, vector_space_);
+  coordinates_ = coordinates;
+  EXPECT_TRUE(does_store_coordinates(vector_space));
+}
+
+TEST_F(VectorSpaceSuite, ArrangeDependingOnLayout) {
+  using Lengths = Array<Length, 2>;
+  using sources::vector_spaces::Layout;
+
+  constexpr Dimension const kDimension0{}, kDimension1{1};
+  constexpr Index const kIndex0{}, kIndex7{7};
+  constexpr Length const k5{5}, k6{6}, k7{7};
+
+  class BlockedVectorSpace : public VectorSpace_ {
+   public:
+    using VectorSpace_::VectorSpace_;
+
+    Coordinates_ const & GetStorage() const { return coordinates_; }
+  };
+
+  Coordinates_ coordinates;  // 6x5 net of the coordinates {i_0; i_1; 0}.
+  for (int index1{}; index1 < 5; ++index1)
+      for (int index0{}; index0 < 6; ++index0)
+          coordinates.emplace_back(Coordinate_{Coordinate{static_cast<Coordinate::Type_>(index0)},
+                                               Coordinate{static_cast<Coordinate::Type_>(index1)}, k0_0_});
+  BlockedVectorSpace vector_space{coordinates, Layout::kBlocked};
+  EXPECT_EQ(vector_space.GetStorage(), coordinates);
+  ASSERT_NO_THROW(vector_space.Arrange(Lengths{k6, k5}));
+  // Blocks of 4x4, 2x4, 4x1, and 2x1 coordinates.
+  Coordinates_ const &storage = vector_space.GetStorage();
+  EXPECT_EQ(storage[4], coordinates[6]);
+  EXPECT_EQ(storage[15], coordinates[21]);
+  EXPECT_EQ(storage[16], coordinates[4]);
+  EXPECT_EQ(storage[23], coordinates[23]);
+  EXPECT_EQ(storage[24], coordinates[24]);
+  EXPECT_EQ(storage[28], coordinates[28]);
+  for (int coordinate{}; coordinate < static_cast<int>(coordinates.size()); ++coordinate)
+      EXPECT_EQ(vector_space[Index{coordinate}], coordinates[coordinate]);
+  EXPECT_EQ(vector_space, VectorSpace_{coordinates});
+  EXPECT_EQ(vector_space.Write(), VectorSpace_{coordinates}.Write());
+  EXPECT_TRUE(vector_space.IsInCompleteBlock(kDimension0, 3));
+  EXPECT_FALSE(vector_space.IsInCompleteBlock(kDimension0, 4));
+  EXPECT_FALSE(vector_space.IsInCompleteBlock(kDimension1, 4));
+  EXPECT_EQ(vector_space.GetStoredCoordinate(vector_space.DetermineArrangedOffset(kDimension0, 2) +
+                                             vector_space.DetermineArrangedOffset(kDimension1, 3)), coordinates[20]);
+
+  coordinates[kIndex7.Get()] = kCoordinate0_;
+  vector_space.Replace(kIndex7, kCoordinate0_);
+  EXPECT_EQ(vector_space.GetStorage()[5], kCoordinate0_);
+  for (int const &index : {24, 18, 12, 6, 0}) coordinates.insert(coordinates.begin() + index, coordinates[index]);
+  ASSERT_NO_THROW(vector_space.Restructure(kDimension0, Lengths{k6, k5}, Lengths{k7, k5},
+                                           [] (Coordinates_ const &line, Coordinates_ &restructured_line) {
+      restructured_line.front() = line.front();
+      std::copy(line.begin(), line.end(), restructured_line.begin() + 1); }));
+  EXPECT_EQ(vector_space, VectorSpace_{coordinates});
+  EXPECT_EQ(vector_space.GetStorage()[4], coordinates[7]);
+  vector_space.BeginTransaction();
+  vector_space.Erase(kIndex0);
+  EXPECT_EQ(vector_space.GetStorage()[3], coordinates[4]);
+  vector_space.RollbackTransaction();
+  EXPECT_EQ(vector_space, VectorSpace_{coordinates});
+  EXPECT_EQ(vector_space.GetStorage(), coordinates);
+}
+
 TEST_F(VectorSpaceSuite, DetermineMaximumDistanceFromOrigin) {
   EXPECT_TRUE(IsEqual(vector_space_.DetermineMaximumDistanceFromOrigin(), Coordinate{std::sqrt(97.0)}));
 }
@@ -108,5 +259,29 @@ TEST_F(VectorSpaceSuite, ThrowIfIndexValueInvalid) {
   EXPECT_THROW(vector_space_.Insert(kIndex12, kCoordinate0_), OutOfRange);
   EXPECT_THROW(vector_space_.Erase(kIndex12), OutOfRange);
 }
+
+TEST_F(VectorSpaceSuite, ThrowIfNumbersOfCoordinatesAreInvalid) {
+  using Lengths = Array<Length, 2>;
+
+  constexpr Dimension const kDimension0{}, kDimension2{2};
+  constexpr Length const k3{3}, k4{4};
+
+  auto const &keep_line = [] (Coordinates_ const &line, Coordinates_ &restructured_line) { restructured_line = line; };
+  EXPECT_THROW(vector_space_.Restructure(kDimension2, Lengths{k4, k3}, Lengths{k4, k3}, keep_line), OutOfRange);
+  EXPECT_THROW(vector_space_.Restructure(kDimension0, Lengths{k3, k3}, Lengths{k3, k3}, keep_line), DomainError);
+}
+
+TEST_F(VectorSpaceSuite, ThrowIfComponentIsNotStoredContiguously) {
+  constexpr Dimension const kDimension0{}, kDimension3{3};
+
+  VectorSpace_ const vector_space{coordinates_, sources::vector_spaces::Layout::kStructureOfArrays};
+  EXPECT_THROW(vector_space_.GetComponent(kDimension0), DomainError);
+  EXPECT_THROW(vector_space.GetComponent(kDimension3), OutOfRange);
+}
+
+TEST_F(VectorSpaceSuite, ThrowIfNoTransactionHasBeenBegun) {
+  EXPECT_THROW(vector_space_.CommitTransaction(), DomainError);
+  EXPECT_THROW(vector_space_.RollbackTransaction(), DomainError);
+}
 #endif
 }  // namespace splinelib::tests::vector_spaces
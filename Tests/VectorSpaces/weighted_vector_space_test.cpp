@@ -78,6 +78,21 @@ TEST_F(WeightedVectorSpaceSuite, Project) {
   EXPECT_EQ(WeightedVectorSpace_::Project(kHomogeneousCoordinate0_), kCoordinate0_);
 }
 
+TEST_F(WeightedVectorSpaceSuite, GetComponentOfHomogeneousCoordinates) {
+  constexpr Dimension const kDimension0{}, kDimension3{3};
+
+  WeightedVectorSpace_ const weighted_vector_space{coordinates_, weights_,
+                                                   sources::vector_spaces::Layout::kStructureOfArrays};
+  EXPECT_EQ(weighted_vector_space, weighted_vector_space_);
+  WeightedVectorSpace_::Component_ const &weighted_first_coordinates = weighted_vector_space.GetComponent(kDimension0),
+                                         &weights = weighted_vector_space.GetComponent(kDimension3);
+  ASSERT_EQ(weights.size(), weights_.size());
+  for (int coordinate{}; coordinate < static_cast<int>(weights_.size()); ++coordinate) {
+    EXPECT_EQ(weights[coordinate], weights_[coordinate].Get());
+    EXPECT_EQ(weighted_first_coordinates[coordinate], coordinates_[coordinate][0].Get() * weights_[coordinate].Get());
+  }
+}
+
 TEST_F(WeightedVectorSpaceSuite, DetermineMaximumDistanceFromOriginAndMinimumWeight) {
   EXPECT_EQ(weighted_vector_space_.DetermineMaximumDistanceFromOriginAndMinimumWeight(),
             WeightedVectorSpace_::MaximumDistanceFromOriginAndMinimumWeight_(Coordinate{std::sqrt(13.0)}, kWeight1_0_));
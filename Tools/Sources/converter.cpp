@@ -10,6 +10,7 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <cstdlib>
 #include <iostream>
 
 #include "Sources/InputOutput/iges.hpp"
@@ -17,11 +18,15 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #include "Sources/InputOutput/operations.hpp"
 #include "Sources/InputOutput/xml.hpp"
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
+#include "Sources/Utilities/tracing.hpp"
 #include "Tools/Sources/log_operations.hpp"
 
 using namespace splinelib;  // NOLINT(build/namespaces)
 using namespace splinelib::sources::input_output;  // NOLINT(build/namespaces)
 using namespace splinelib::tools::sources::log_operations;  // NOLINT(build/namespaces)
+namespace instrumentation = splinelib::sources::utilities::instrumentation;
+namespace tracing = splinelib::sources::utilities::tracing;
 using FileFormat = operations::FileFormat;
 using std::cout, std::endl;
 
@@ -30,13 +35,17 @@ using std::cout, std::endl;
 // Example:
 //   $ converter --help (explains usage)
 //   $ converter converter.log
+//   $ SPLINELIB_TRACE=converter.json converter converter.log (writes a Chrome trace event file as well)
 int main(int argc, char *argv[]) {
+  char const * const name_trace{std::getenv(tracing::kFileNameVariable)};
+  if (name_trace) tracing::Start();
 #ifndef NDEBUG
   try {
     ThrowIfCommandLineArgumentsAreInvalid(argc);
 #endif
     String const name_log{argv[1]};
-    auto const &[name_input, name_output, splines, ignored] = Read<LogType::kConverter>(name_log);
+    auto const &[name_input, name_output, splines, ignored, ignored_number_of_threads] =
+        Read<LogType::kConverter>(name_log);
     SplinesRead splines_read{operations::Read(name_input)};
     SplinesConsidered splines_converted;
     switch (operations::DetermineFileFormat(name_output)) {
@@ -55,11 +64,18 @@ int main(int argc, char *argv[]) {
       default:
         break;
     }
-    Append(name_log, {name_input, name_output, splines_converted, ignored});
+    Statistics const &statistics = instrumentation::GetSnapshot();
+    Append(name_log, {name_input, name_output, splines_converted, ignored, ignored_number_of_threads},
+           (instrumentation::kIsEnabled ? &statistics : nullptr));
     cout << "Conversion succeeded: Check the information appended to the log file for further information." << endl;
 #ifndef NDEBUG
   } catch (RuntimeError const &exception) { cout << exception.what() << endl; }
 #endif
+  // Also written if an error occurred, so that the spans up to the error can be inspected.
+  if (name_trace) {
+    tracing::Stop();
+    tracing::Write(name_trace);
+  }
 
   return 0;
 }
@@ -22,10 +22,11 @@ namespace splinelib::tools::sources::log_operations {
 
 namespace system_operations = splinelib::sources::utilities::system_operations;
 
-void Append(String const &name_log, LogInformation const &log_information) {
+void Append(String const &name_log, LogInformation const &log_information, Statistics const * const statistics) {
   using OutputStream = system_operations::OutputStream;
   using std::get, splinelib::sources::utilities::string_operations::Write;
 
+  splinelib::sources::utilities::tracing::ScopedSpan const span{"log_operations::Append", name_log.c_str()};
   OutputStream log{system_operations::Open<OutputStream, system_operations::kModeAppend>(name_log)};
   system_operations::LocalTime const &timeinfo = system_operations::GetLocalTime();
   log << "\nlog:\n" << std::asctime(&timeinfo);
@@ -44,6 +45,11 @@ void Append(String const &name_log, LogInformation const &log_information) {
   }
   log << " in the file \"" << get<0>(log_information) << "\" " << (is_single_spline ? "was" : "were")
       << " considered and exported to the file \"" << get<1>(log_information) << "\".\n";
+  if (NumberOfThreads const &number_of_threads = get<4>(log_information); number_of_threads != NumberOfThreads{}) {
+    bool const &is_single_thread = (number_of_threads == NumberOfThreads{1});
+    log << "Sampling used " << Write(number_of_threads) << " thread" << (is_single_thread ? "" : "s") << ".\n";
+  }
+  if (statistics) log << "instrumentation:\n" << splinelib::sources::utilities::instrumentation::Write(*statistics);
 }
 
 String SkipBlankLineAndReadSectionIdentifier(InputStream &log) {
@@ -14,17 +14,19 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 #define TOOLS_SOURCES_LOG_OPERATIONS_HPP_
 
 #include "Sources/InputOutput/vtk.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/named_type.hpp"
 #include "Sources/Utilities/std_container_operations.hpp"
 #include "Sources/Utilities/string_operations.hpp"
 #include "Sources/Utilities/system_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 
 // Log operations for converting and sampling splines.
 //
 // Example:
 //   LogInformation log_info{Read<LogType::kConverter>(converter.log)};
 //   SplinesConsidered iges_splines{RemoveSplinesOfTooHighDimensionalities<2, 3>(get<2>(log_info), splines_read)};
-//   Append(converter.log, log_info_iges);
+//   Append(converter.log, log_info_iges, &statistics);  // Appends the instrumentation statistics as well.
 namespace splinelib::tools::sources::log_operations {
 
 enum class LogType { kConverter, kSampler };
@@ -32,9 +34,12 @@ using InputStream = splinelib::sources::utilities::system_operations::InputStrea
 using NumbersOfParametricCoordinates = splinelib::sources::input_output::vtk::NumbersOfParametricCoordinates;
 using SplinesConsidered = Vector<Index>;
 using SplinesRead = splinelib::sources::input_output::Splines;
-using LogInformation = Tuple<String, String, SplinesConsidered, NumbersOfParametricCoordinates>;
+// The number of threads is only given for sampling (optionally, zero if not given).
+using LogInformation = Tuple<String, String, SplinesConsidered, NumbersOfParametricCoordinates, NumberOfThreads>;
+using Statistics = splinelib::sources::utilities::instrumentation::Statistics;
 
-void Append(String const &name_log, LogInformation const &log_information);
+void Append(String const &name_log, LogInformation const &log_information,
+            Statistics const * const statistics = nullptr);
 template<LogType log_type>
 LogInformation Read(String const name_log);
 
@@ -10,17 +10,24 @@ WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEM
 COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
 OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <cstdlib>
+#include <algorithm>
 #include <iostream>
+#include <thread>
 
 #include "Sources/InputOutput/operations.hpp"
 #include "Sources/InputOutput/vtk.hpp"
 #include "Sources/Utilities/error_handling.hpp"
+#include "Sources/Utilities/instrumentation.hpp"
 #include "Sources/Utilities/string_operations.hpp"
+#include "Sources/Utilities/tracing.hpp"
 #include "Tools/Sources/log_operations.hpp"
 
 using namespace splinelib;  // NOLINT(build/namespaces)
 using namespace splinelib::sources::input_output;  // NOLINT(build/namespaces)
 using namespace splinelib::tools::sources::log_operations;  // NOLINT(build/namespaces)
+namespace instrumentation = splinelib::sources::utilities::instrumentation;
+namespace tracing = splinelib::sources::utilities::tracing;
 using FileFormat = operations::FileFormat;
 using std::cout, std::endl, std::to_string;
 
@@ -29,14 +36,20 @@ using std::cout, std::endl, std::to_string;
 // Example:
 //   $ sampler --help (explains usage)
 //   $ sampler sampler.log
+//   $ SPLINELIB_TRACE=sampler.json sampler sampler.log (writes a Chrome trace event file as well)
 int main(int argc, char *argv[]) {
+  char const * const name_trace{std::getenv(tracing::kFileNameVariable)};
+  if (name_trace) tracing::Start();
 #ifndef NDEBUG
   try {
     ThrowIfCommandLineArgumentsAreInvalid(argc);
 #endif
     String const name_log{argv[1]};
-    auto const &[name_input, name_output, splines, numbers_of_parametric_coordinates] =
+    auto const &[name_input, name_output, splines, numbers_of_parametric_coordinates, number_of_threads_given] =
         Read<LogType::kSampler>(name_log);
+    // std::thread::hardware_concurrency returns zero if the number of hardware threads cannot be determined.
+    NumberOfThreads const number_of_threads{(number_of_threads_given != NumberOfThreads{}) ? number_of_threads_given :
+        NumberOfThreads{std::max(static_cast<int>(std::thread::hardware_concurrency()), 1)}};
     SplinesRead splines_read{operations::Read(name_input)};
     SplinesConsidered splines_sampled;
 #ifndef NDEBUG
@@ -50,17 +63,24 @@ int main(int argc, char *argv[]) {
       NumbersOfParametricCoordinates numbers_of_parametric_coordinates_read{numbers_of_parametric_coordinates};
       splines_sampled = RemoveSplinesOfTooHighDimensionalities<3, 3>(splines, splines_read,
                                                                      &numbers_of_parametric_coordinates_read);
-      vtk::Sample(splines_read, name_output, numbers_of_parametric_coordinates_read);
+      vtk::Sample(splines_read, name_output, numbers_of_parametric_coordinates_read, number_of_threads);
     } else {
 #ifndef NDEBUG
       throw RuntimeError("Output of spline sampling must be stored in VTK (.vtk) files.");
 #endif
     }
-    Append(name_log, {name_input, name_output, splines_sampled, numbers_of_parametric_coordinates});
+    Statistics const &statistics = instrumentation::GetSnapshot();
+    Append(name_log, {name_input, name_output, splines_sampled, numbers_of_parametric_coordinates, number_of_threads},
+           (instrumentation::kIsEnabled ? &statistics : nullptr));
     cout << "Sampling succeeded: Check the information appended to the log file for further information." << endl;
 #ifndef NDEBUG
   } catch (RuntimeError const &exception) { cout << exception.what() << endl; }
 #endif
+  // Also written if an error occurred, so that the spans up to the error can be inspected.
+  if (name_trace) {
+    tracing::Stop();
+    tracing::Write(name_trace);
+  }
 
   return 0;
 }
@@ -33,6 +33,7 @@ class LogOperationsSuite : public testing::Test {
 
   constexpr static Index_ const kIndex0_{};
   constexpr static NumberOfParametricCoordinates::value_type const kLength10{10};
+  constexpr static NumberOfThreads const kNumberOfThreads2_{2};
   inline static SplinesConsidered const kSplinesConsidered_{kIndex0_};
   NumbersOfParametricCoordinates numbers_of_parametric_coordinates_{{kLength10, kLength10}};
 };
@@ -41,16 +42,22 @@ TEST_F(LogOperationsSuite, Append) {
   constexpr Index_ const kIndex1_{1};
   String const kInput{"# Replace by path to input file!"}, kOutput{"# Replace by path to output file!"};
 
-  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {}, {}})));
-  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_}, {}})));
-  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_, kIndex1_}, {}})));
-  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_, kIndex1_, Index_{2}}, {}})));
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {}, {}, {}})));
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_}, {}, {}})));
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_, kIndex1_}, {}, {}})));
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_, kIndex1_, Index_{2}}, {},
+                                                              {}})));
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_},
+      numbers_of_parametric_coordinates_, kNumberOfThreads2_})));
+  Statistics const statistics{};
+  EXPECT_NO_THROW(Append(log_invalid_splines, (LogInformation{kInput, kOutput, {kIndex0_}, {}, {}}), &statistics));
 }
 
 TEST_F(LogOperationsSuite, Read) {
-  EXPECT_EQ(Read<LogType::kConverter>(log_converter), (LogInformation{xml_file, xml_itd, {}, {}}));
+  EXPECT_EQ(Read<LogType::kConverter>(log_converter), (LogInformation{xml_file, xml_itd, {}, {}, {}}));
   EXPECT_EQ(Read<LogType::kSampler>(log_sampler), (LogInformation{xml_itd, itd_vtk, kSplinesConsidered_,
-                                                                  numbers_of_parametric_coordinates_}));
+                                                                  numbers_of_parametric_coordinates_,
+                                                                  kNumberOfThreads2_}));
 }
 
 TEST_F(LogOperationsSuite, SkipBlankLineAndReadSectionIdentifier) {